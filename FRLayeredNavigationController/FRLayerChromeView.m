@@ -40,6 +40,7 @@
 
 @property (nonatomic, readonly, strong) UIView *savedBackgroundView;
 @property (nonatomic, assign, readonly) BOOL iOS7OrNewer;
+@property (nonatomic, assign) BOOL toolbarNeedsUpdate;
 
 @end
 
@@ -113,23 +114,38 @@
         [self.toolbar setItems:@[flexibleSpace, _rightBarButtonItem]];
     }
 
+    /* no setNeedsLayout: only called from init (no layout yet) and layoutSubviews (which lays out right after) */
+}
+
+- (void)setNeedsToolbarUpdate
+{
+    /* coalesced, the toolbar gets updated on the next layout pass */
+    self.toolbarNeedsUpdate = YES;
     [self setNeedsLayout];
 }
 
 - (void)setLeftBarButtonItem:(UIBarButtonItem *)leftBarButtonItem
 {
-    _leftBarButtonItem = leftBarButtonItem;
-    [self manageToolbar];
+    if (_leftBarButtonItem != leftBarButtonItem) {
+        _leftBarButtonItem = leftBarButtonItem;
+        [self setNeedsToolbarUpdate];
+    }
 }
 
 - (void)setRightBarButtonItem:(UIBarButtonItem *)rightBarButtonItem
 {
-    _rightBarButtonItem = rightBarButtonItem;
-    [self manageToolbar];
+    if (_rightBarButtonItem != rightBarButtonItem) {
+        _rightBarButtonItem = rightBarButtonItem;
+        [self setNeedsToolbarUpdate];
+    }
 }
 
 - (void)setTitle:(NSString *)aTitle
 {
+    if (aTitle == self->_title || [aTitle isEqualToString:self->_title]) {
+        return;
+    }
+
     if ([self.titleView isKindOfClass:[UILabel class]]) {
         UILabel *label = (UILabel *)self.titleView;
         label.text = aTitle;
@@ -142,6 +158,11 @@
 {
     [super layoutSubviews];
 
+    if (self.toolbarNeedsUpdate) {
+        self.toolbarNeedsUpdate = NO;
+        [self manageToolbar];
+    }
+
     CGFloat barButtonItemsSpace = (self.leftBarButtonItem!=nil?48:0) + (self.rightBarButtonItem!=nil?48:0);
 
     self.toolbar.frame = CGRectMake(0,
@@ -28,9 +28,21 @@
 
 /* Local Imports */
 #import "FRLayerController.h"
+#import "FRViewBackend.h"
 
 @interface FRLayerController (Protected)
 
 @property (nonatomic, strong) FRLayerChromeView *chromeView;
+@property (nonatomic, readonly, strong) UIImage *thumbnail;
+@property (nonatomic, readonly) BOOL thumbnailNeedsUpdate;
+
+/**
+ * The backend the layer's view operations are performed through, the FRLayeredNavigationController sets its own.
+ */
+@property (nonatomic, strong) id<FRViewBackend> viewBackend;
+
+- (void)updateChromeTitle;
+- (void)setNeedsThumbnailUpdate;
+- (BOOL)updateThumbnailWithScale:(CGFloat)scale;
 
 @end
@@ -32,9 +32,11 @@
 /* Local Imports */
 #import "FRDLog.h"
 #import "FRLayerController.h"
+#import "FRLayerController+Protected.h"
 #import "FRLayerChromeView.h"
 #import "FRLayeredNavigationItem+Protected.h"
 #import "FRiOSVersion.h"
+#import "UIViewController+FRLayeredNavigationController.h"
 
 @interface FRLayerController ()
 
@@ -45,6 +47,9 @@
 @property (nonatomic, strong) FRLayerChromeView *chromeView;
 @property (nonatomic, strong) UIView *borderView;
 @property (nonatomic, weak) UIView *contentView;
+@property (nonatomic, readwrite, strong) UIImage *thumbnail;
+@property (nonatomic, readwrite) BOOL thumbnailNeedsUpdate;
+@property (nonatomic, strong) id<FRViewBackend> viewBackend;
 
 @property (nonatomic, assign, readonly) BOOL isIOS7OrNewer;
 
@@ -61,30 +66,54 @@
         _layeredNavigationItem.layerController = self;
         _contentViewController = vc;
         _isIOS7OrNewer = [FRiOSVersion isIOS7OrNewer];
-        [_contentViewController addObserver:self forKeyPath:@"title" options:NSKeyValueObservingOptionNew context:nil];
         _maximumWidth = maxWidth;
+        _thumbnailNeedsUpdate = YES;
+        _viewBackend = [[FRUIKitViewBackend alloc] init];
     }
 
     return self;
 }
 
-- (void)observeValueForKeyPath:(NSString *)keyPath
-                      ofObject:(__unused id)object
-                        change:(NSDictionary *)change
-                       context:(__unused void *)context
+- (void)dealloc
 {
-    if ([keyPath isEqualToString:@"title"]) {
-        self.chromeView.title = change[@"new"];
+    self.layeredNavigationItem.layerController = nil;
+}
+
+#pragma mark - internal methods
+
+- (void)updateChromeTitle
+{
+    NSString *title = self.layeredNavigationItem.title;
+
+    if (title == nil) {
+        title = self.contentViewController.title;
     }
+
+    /* no-op if the title didn't change */
+    self.chromeView.title = title;
 }
 
-- (void)dealloc
+- (void)setNeedsThumbnailUpdate
 {
-    self.layeredNavigationItem.layerController = nil;
-    [_contentViewController removeObserver:self forKeyPath:@"title"];
+    self.thumbnailNeedsUpdate = YES;
 }
 
-#pragma mark - internal methods
+- (BOOL)updateThumbnailWithScale:(CGFloat)scale
+{
+    if (![self isViewLoaded] || self.view.window == nil || CGRectIsEmpty(self.view.bounds)) {
+        /* nothing to render (yet) */
+        return NO;
+    }
+
+    /* rendering with a small scale factor gives us the downscaled image directly */
+    UIGraphicsBeginImageContextWithOptions(self.view.bounds.size, NO, scale);
+    [self.view.layer renderInContext:UIGraphicsGetCurrentContext()];
+    self.thumbnail = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    self.thumbnailNeedsUpdate = NO;
+    return YES;
+}
 
 - (CGFloat)layerChromeHeight
 {
@@ -115,7 +144,7 @@
                                   [self layerChromeHeight] + borderSpacing,
                                   CGRectGetWidth(self.view.bounds)-(2*borderSpacing),
                                   CGRectGetHeight(self.view.bounds)-[self layerChromeHeight]-(2*borderSpacing));
-        self.chromeView.frame = chromeFrame;
+        [self.viewBackend setFrame:chromeFrame forView:self.chromeView];
     } else {
         borderFrame = CGRectMake(0,
                                  0,
@@ -128,11 +157,11 @@
     }
 
     if (self.layeredNavigationItem.hasBorder) {
-        self.borderView.frame = borderFrame;
+        [self.viewBackend setFrame:borderFrame forView:self.borderView];
     }
     if (self.layeredNavigationItem.autosizeContent) {
         UIView * const contentView = self.contentView;
-        contentView.frame = contentFrame;
+        [self.viewBackend setFrame:contentFrame forView:contentView];
     }
 }
 
@@ -151,7 +180,7 @@
         self.borderView.backgroundColor = [UIColor clearColor];
         self.borderView.layer.borderWidth = 1;
         self.borderView.layer.borderColor = [UIColor colorWithWhite:236.0f/255.0f alpha:1].CGColor;
-        [self.view addSubview:self.borderView];
+        [self.viewBackend addSubview:self.borderView toView:self.view];
     }
 
     if (self.layeredNavigationItem.hasChrome) {
@@ -161,7 +190,7 @@
                            self.contentViewController.title : navItem.title
                                                            yOffset:[self layerChromeOffset]];
 
-        [self.view addSubview:self.chromeView];
+        [self.viewBackend addSubview:self.chromeView toView:self.view];
     }
 
     if (contentView == nil && self.contentViewController.parentViewController == self) {
@@ -170,7 +199,7 @@
     }
 
     if (contentView != nil) {
-        [self.view addSubview:contentView];
+        [self.viewBackend addSubview:contentView toView:self.view];
     }
 }
 
@@ -195,6 +224,8 @@
     self.borderView = nil;
     self.chromeView = nil;
     self.contentView = nil;
+    self.thumbnail = nil;
+    self.thumbnailNeedsUpdate = YES;
 }
 
 - (BOOL)shouldAutorotateToInterfaceOrientation:(__unused UIInterfaceOrientation)interfaceOrientation
@@ -205,20 +236,23 @@
 - (void)willMoveToParentViewController:(UIViewController *)parent
 {
     [super willMoveToParentViewController:parent];
+    [UIViewController invalidateLayeredNavigationLookupCaches];
     UIView *contentView = self.contentView;
 
     if (parent != nil) {
         /* will shortly attach to parent */
-        [self addChildViewController:self.contentViewController];
+        [self.viewBackend addChildViewController:self.contentViewController toParentViewController:self];
 
+        /* load our view first, otherwise loadView would already add the content view */
+        UIView * const layerView = self.view;
         contentView = self.contentViewController.view;
         self.contentView = contentView;
-        [self.view addSubview:contentView];
+        [self.viewBackend addSubview:contentView toView:layerView];
     } else {
         /* will shortly detach from parent view controller */
-        [self.contentViewController willMoveToParentViewController:nil];
+        [self.viewBackend childViewController:self.contentViewController willMoveToParentViewController:nil];
 
-        [contentView removeFromSuperview];
+        [self.viewBackend removeViewFromSuperview:contentView];
         self.contentView = nil;
     }
 }
@@ -226,13 +260,14 @@
 - (void)didMoveToParentViewController:(UIViewController *)parent
 {
     [super didMoveToParentViewController:parent];
+    [UIViewController invalidateLayeredNavigationLookupCaches];
 
     if (parent != nil) {
         /* just attached to parent view controller */
-        [self.contentViewController didMoveToParentViewController:self];
+        [self.viewBackend childViewController:self.contentViewController didMoveToParentViewController:self];
     } else {
         /* did just detach */
-        [self.contentViewController removeFromParentViewController];
+        [self.viewBackend removeChildViewControllerFromParentViewController:self.contentViewController];
     }
 }
 
@@ -0,0 +1,99 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Local Imports */
+#import "FRLayerLayoutSolver.h"
+#import "FRLayerController.h"
+#import "FRLayeredNavigationItem.h"
+
+@implementation FRLayerLayoutSolver
+
++ (CGFloat)widthOfItem:(const FRLayeredNavigationItem *)item
+          maximumWidth:(BOOL)maxWidth
+              initialX:(CGFloat)initX
+        containerWidth:(CGFloat)containerWidth
+{
+    /*
+     * layers starting (almost) offscreen, deep in the stack or in narrow containers, still get at least the width a
+     * compacted layer shows instead of nothing or a negative width
+     */
+    const CGFloat availableWidth = MAX(containerWidth - initX, FRLayeredNavigationControllerStandardDistance);
+    CGFloat width;
+
+    if (maxWidth) {
+        width = availableWidth;
+    } else {
+        width = item.width > 0 ? item.width : FRLayeredNavigationControllerStandardWidth;
+
+        if (item.widthPriority < FRLayeredNavigationItemWidthPriorityRequired) {
+            /* optional width: shrink to what is available */
+            width = MIN(width, availableWidth);
+        }
+    }
+
+    if (item.maximumWidthLimit > 0) {
+        width = MIN(width, item.maximumWidthLimit);
+    }
+    if (item.minimumWidth > 0) {
+        width = MAX(width, item.minimumWidth);
+    }
+
+    return width;
+}
+
++ (NSArray *)initialFramesOfLayerControllers:(NSArray *)layerControllers containerSize:(CGSize)containerSize
+{
+    NSMutableArray *frames = [NSMutableArray arrayWithCapacity:[layerControllers count]];
+    const FRLayeredNavigationItem *parentItem = nil;
+    CGPoint initPos = CGPointZero;
+
+    for (FRLayerController *vc in layerControllers) {
+        const FRLayeredNavigationItem *item = vc.layeredNavigationItem;
+
+        if (parentItem == nil) {
+            /* the root layer stays where it is */
+            initPos = item.initialViewPosition;
+        } else {
+            initPos = CGPointMake(initPos.x + ((parentItem.nextItemDistance >= 0) ?
+                                               parentItem.nextItemDistance :
+                                               FRLayeredNavigationControllerStandardDistance),
+                                  0);
+        }
+
+        const CGFloat width = [self widthOfItem:item
+                                   maximumWidth:vc.maximumWidth
+                                       initialX:initPos.x
+                                 containerWidth:containerSize.width];
+        [frames addObject:[NSValue valueWithCGRect:CGRectMake(initPos.x, initPos.y, width, containerSize.height)]];
+        parentItem = item;
+    }
+
+    return frames;
+}
+
+@end
@@ -0,0 +1,130 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Library */
+#import <QuartzCore/QuartzCore.h>
+
+/* Local Imports */
+#import "FRLayerOverviewView.h"
+
+#define FRLayerOverviewViewSpacing ((float)20.0f)
+#define FRLayerOverviewViewRelativeHeight ((float)0.6f)
+
+@interface FRLayerOverviewView ()
+
+@property (nonatomic, strong) UIScrollView *scrollView;
+@property (nonatomic, strong) NSArray *thumbnailButtons;
+@property (nonatomic, copy) void (^selectionHandler)(NSUInteger layerIndex);
+
+@end
+
+@implementation FRLayerOverviewView
+
+- (id)initWithFrame:(CGRect)frame
+         thumbnails:(NSArray *)thumbnails
+   selectionHandler:(void (^)(NSUInteger layerIndex))selectionHandler
+{
+    self = [super initWithFrame:frame];
+    if (self) {
+        _selectionHandler = [selectionHandler copy];
+
+        self.backgroundColor = [UIColor colorWithWhite:0 alpha:0.7f];
+        self.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+
+        _scrollView = [[UIScrollView alloc] initWithFrame:self.bounds];
+        _scrollView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+        _scrollView.backgroundColor = [UIColor clearColor];
+        [self addSubview:_scrollView];
+
+        NSMutableArray *buttons = [NSMutableArray arrayWithCapacity:[thumbnails count]];
+        for (id thumbnail in thumbnails) {
+            UIButton *button = [UIButton buttonWithType:UIButtonTypeCustom];
+            button.backgroundColor = [UIColor whiteColor];
+            button.layer.shadowColor = [UIColor blackColor].CGColor;
+            button.layer.shadowOpacity = 0.5;
+            button.layer.shadowRadius = 5.0;
+            button.imageView.contentMode = UIViewContentModeScaleAspectFill;
+            button.contentHorizontalAlignment = UIControlContentHorizontalAlignmentFill;
+            button.contentVerticalAlignment = UIControlContentVerticalAlignmentFill;
+            [button addTarget:self action:@selector(thumbnailTapped:) forControlEvents:UIControlEventTouchUpInside];
+
+            if (thumbnail != [NSNull null]) {
+                [button setImage:thumbnail forState:UIControlStateNormal];
+            }
+
+            [buttons addObject:button];
+            [_scrollView addSubview:button];
+        }
+        _thumbnailButtons = [buttons copy];
+    }
+    return self;
+}
+
+- (void)setThumbnail:(UIImage *)thumbnail forLayerAtIndex:(NSUInteger)layerIndex
+{
+    if (layerIndex < [self.thumbnailButtons count]) {
+        UIButton *button = [self.thumbnailButtons objectAtIndex:layerIndex];
+        [button setImage:thumbnail forState:UIControlStateNormal];
+        [self setNeedsLayout];
+    }
+}
+
+- (void)thumbnailTapped:(UIButton *)sender
+{
+    const NSUInteger layerIndex = [self.thumbnailButtons indexOfObject:sender];
+
+    if (layerIndex != NSNotFound && self.selectionHandler != nil) {
+        self.selectionHandler(layerIndex);
+    }
+}
+
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+
+    const CGFloat height = CGRectGetHeight(self.bounds) * FRLayerOverviewViewRelativeHeight;
+    const CGFloat y = (CGRectGetHeight(self.bounds) - height) / 2;
+    CGFloat x = FRLayerOverviewViewSpacing;
+
+    for (UIButton *button in self.thumbnailButtons) {
+        const CGSize imageSize = [button imageForState:UIControlStateNormal].size;
+        CGFloat width = height * 0.75f;
+
+        if (imageSize.height > 0) {
+            width = height * imageSize.width / imageSize.height;
+        }
+
+        button.frame = CGRectMake(x, y, width, height);
+        button.layer.shadowPath = [UIBezierPath bezierPathWithRect:button.bounds].CGPath;
+        x += width + FRLayerOverviewViewSpacing;
+    }
+
+    self.scrollView.contentSize = CGSizeMake(x, CGRectGetHeight(self.bounds));
+}
+
+@end
@@ -0,0 +1,47 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Local Imports */
+#import "FRLayeredNavigationController.h"
+#import "FRViewBackend.h"
+
+@interface FRLayeredNavigationController (Protected)
+
+/**
+ * The backend all view operations are performed through, including the ones of the layers (FRLayerController).
+ * Defaults to an instance of FRUIKitViewBackend .
+ */
+@property (nonatomic, strong) id<FRViewBackend> viewBackend;
+
+/**
+ * Drops the cached layer layouts and lays out the layers again on the next layout pass. Called whenever a property
+ * of a FRLayeredNavigationItem changes which the layer widths depend on.
+ */
+- (void)setNeedsLayerLayout;
+
+@end
@@ -71,6 +71,20 @@
 - (void)layeredNavigationController:(FRLayeredNavigationController*)layeredController
                   didMoveController:(UIViewController*)controller;
 
+/**
+ * Sent by the layered navigation controller when the user lifted the finger and the layers are about to snap
+ * into their final positions. This message is sent before the snapping animation starts, so the delegate can
+ * already start preparing the content of the layers that are going to be revealed.
+ *
+ * @param layeredController The layered controller being interacted with.
+ * @param frames The final frames (`NSValue` wrapped `CGRect`s) of all the layers, in the order of
+ *               FRLayeredNavigationController.viewControllers .
+ * @param revealedControllers The view controllers which will have a larger visible area after snapping.
+ */
+- (void)layeredNavigationController:(FRLayeredNavigationController*)layeredController
+                   willSnapToFrames:(NSArray *)frames
+           revealingViewControllers:(NSArray *)revealedControllers;
+
 @end
 
 typedef enum {
@@ -224,6 +238,103 @@ typedef enum {
              configuration:(void (^)(FRLayeredNavigationItem *item))configuration
                  direction:(FRLayeredAnimationDirection)direction;
 
+/**
+ * Replaces the whole navigation stack at once, for example to restore state or to follow a deep link. Much cheaper
+ * than pushing the view controllers one by one: all the layers are built directly at their final (maximally
+ * compressed) position. Layers which already show the right view controllers at the bottom of the stack are kept.
+ * If the view isn't loaded yet (state restoration), it doesn't get loaded: the layers are laid out for the screen.
+ *
+ * Same as setViewControllers:maximumWidths:configurations:animated: with all the layers using `maximumWidth:NO`.
+ *
+ * @param viewControllers The new view controllers, the first one becomes the root view controller.
+ * @param configurations Optional: the configuration blocks (see
+ *                       pushViewController:inFrontOf:maximumWidth:animated:configuration: ) for the new view
+ *                       controllers, at the same index as the view controller. Use `NSNull` for no configuration.
+ *                       The configurations at the indices of kept layers are ignored, those keep their
+ *                       FRLayeredNavigationItem as it is.
+ * @param animated Set this value to `YES` to cross-fade to the new stack.
+ */
+- (void)setViewControllers:(NSArray *)viewControllers
+            configurations:(NSArray *)configurations
+                  animated:(BOOL)animated;
+
+/**
+ * Replaces the whole navigation stack at once, see setViewControllers:configurations:animated: .
+ *
+ * @param viewControllers The new view controllers, the first one becomes the root view controller.
+ * @param maximumWidths Optional: `NSNumber` wrapped BOOLs, at the same index as the view controller. `YES` gives the
+ *                      layer the maximum width (see pushViewController:inFrontOf:maximumWidth:animated: ), missing
+ *                      entries count as `NO`. The root view controller never gets the maximum width.
+ * @param configurations Optional: the configuration blocks for the new view controllers, at the same index as the
+ *                       view controller. Use `NSNull` for no configuration. Ignored for kept layers.
+ * @param animated Set this value to `YES` to cross-fade to the new stack.
+ */
+- (void)setViewControllers:(NSArray *)viewControllers
+             maximumWidths:(NSArray *)maximumWidths
+            configurations:(NSArray *)configurations
+                  animated:(BOOL)animated;
+
+/**
+ * Predicts where the layers would snap to if the user lifted the finger now, moving with the given velocity.
+ * The layers are not moved. This can be used during a pan (for example with the projected velocity) to start
+ * preparing the content which is going to be revealed.
+ *
+ * @param velocity The horizontal velocity of the pan gesture in points per second.
+ * @param revealedViewControllers If not `NULL`, is set to the view controllers which will have a larger visible
+ *                                area after snapping.
+ * @return The predicted frames (`NSValue` wrapped `CGRect`s) of all the layers, in the order of viewControllers .
+ */
+- (NSArray *)predictedFramesForHorizontalVelocity:(CGFloat)velocity
+                          revealedViewControllers:(NSArray * __autoreleasing *)revealedViewControllers;
+
+/**
+ * Touches on views of the given class (or their subviews) never move the layers. By default, this is the case for
+ * `UISlider` and the table view cell reorder control. Use this for example for horizontally scrolling content.
+ *
+ * @param viewClass The class of the views to exclude.
+ */
+- (void)excludeViewClassFromPanning:(Class)viewClass;
+
+/**
+ * Touches in the given view (or its subviews) never move the layers. The view is not retained.
+ *
+ * @param view The view to exclude.
+ */
+- (void)excludeViewFromPanning:(UIView *)view;
+
+/**
+ * Reverts excludeViewFromPanning: .
+ *
+ * @param view The view which should move the layers again.
+ */
+- (void)includeViewInPanning:(UIView *)view;
+
+/**
+ * Marks the content of a view controller's layer as changed. Its thumbnail used in the overview gets re-rendered
+ * in the background (one layer per run loop iteration) while the overview is shown.
+ *
+ * @param vc The view controller whose content changed.
+ */
+- (void)setNeedsThumbnailUpdateForViewController:(UIViewController *)vc;
+
+/**
+ * Shows an overview of all the layers built from downscaled thumbnails. Tapping a thumbnail pops to that layer
+ * (cross-fading from the overview to the remaining layers). While the overview is shown, the layers can't be panned.
+ * Pushing or popping a view controller hides it.
+ *
+ * Thumbnails are only rendered while the overview is shown, missing and outdated ones appear as they get rendered.
+ *
+ * @param animated Set this value to `YES` to fade the overview in.
+ */
+- (void)showOverviewAnimated:(BOOL)animated;
+
+/**
+ * Hides the overview of all the layers.
+ *
+ * @param animated Set this value to `YES` to fade the overview out.
+ */
+- (void)hideOverviewAnimated:(BOOL)animated;
+
 /**
  * Compresses all visible view controllers together, so they're all separated by the minimum distance.
  *
@@ -242,11 +353,28 @@ typedef enum {
  */
 @property (nonatomic, readonly) NSArray *viewControllers;
 
+/**
+ * The layers only start moving if the horizontal velocity of the pan is at least this many times the vertical
+ * velocity. Defaults to 1, set to 0 to move the layers for pans in any direction.
+ */
+@property (nonatomic) CGFloat panningDirectionLockRatio;
+
 /**
  * Wheater to drop all layers except the root view controller when pulled far enough to the right
  */
 @property (nonatomic) BOOL dropLayersWhenPulledRight;
 
+/**
+ * How far (in points) the first layer has to be pulled away from the root view controller to drop the layers.
+ * Only used if dropLayersWhenPulledRight is enabled. Defaults to 300.
+ */
+@property (nonatomic) CGFloat dropZoneDistance;
+
+/**
+ * If the overview of all the layers is currently shown. (read-only)
+ */
+@property (nonatomic, readonly) BOOL overviewVisible;
+
 /**
  * The view controller in the top layer. (read-only)
  */
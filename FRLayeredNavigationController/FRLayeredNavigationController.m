@@ -33,14 +33,19 @@
 /* Local Imports */
 #import "FRDLog.h"
 #import "FRLayeredNavigationController.h"
+#import "FRLayeredNavigationController+Protected.h"
 #import "FRLayerController.h"
+#import "FRLayerController+Protected.h"
+#import "FRLayerLayoutSolver.h"
+#import "FRLayerOverviewView.h"
 #import "FRLayeredNavigationItem.h"
 #import "FRLayeredNavigationItem+Protected.h"
 #import "UIViewController+FRLayeredNavigationController.h"
 
-#define FRLayeredNavigationControllerStandardDistance ((float)64.0f)
-#define FRLayeredNavigationControllerStandardWidth ((float)400.0f)
 #define FRLayeredNavigationControllerSnappingVelocityThreshold ((float)100.0f)
+/* relative to the screen scale */
+#define FRLayeredNavigationControllerThumbnailScale ((float)0.25f)
+#define FRLayeredNavigationControllerDropZoneHysteresis ((float)20.0f)
 
 typedef enum {
     SnappingPointsMethodNearest,
@@ -48,14 +53,35 @@ typedef enum {
     SnappingPointsMethodExpand
 } SnappingPointsMethod;
 
+/* a zeroing weak reference which can be stored in collections (no weak collections on iOS 5) */
+@interface FRLayeredNavigationWeakReference : NSObject
+
+@property (nonatomic, weak) id object;
+
+@end
+
+@implementation FRLayeredNavigationWeakReference
+
+@end
+
 @interface FRLayeredNavigationController ()
 
 @property (nonatomic, readwrite, strong) UIPanGestureRecognizer *panGR;
 @property (nonatomic, readwrite, strong) NSMutableArray *layeredViewControllers;
 @property (nonatomic, readwrite, weak) UIViewController *outOfBoundsViewController;
 @property (nonatomic, readwrite, weak) UIView *firstTouchedView;
-@property (nonatomic, weak) UIView *dropNotificationView;
+@property (nonatomic, strong) UIView *dropNotificationView;
+@property (nonatomic) BOOL dropZoneActive;
+@property (nonatomic) NSUInteger runningLayerAnimations;
 @property (nonatomic, weak) UIViewController *firstTouchedController;
+@property (nonatomic, strong) id<FRViewBackend> viewBackend;
+@property (nonatomic, strong) NSMutableDictionary *layoutCache;
+@property (nonatomic) CGRect screenBounds;
+@property (nonatomic, strong) FRLayerOverviewView *overviewView;
+@property (nonatomic) BOOL thumbnailUpdateScheduled;
+@property (nonatomic, strong) NSMutableSet *panningExcludedViewClasses;
+@property (nonatomic, strong) NSMutableArray *panningExcludedViews;
+@property (nonatomic, assign) CFRunLoopObserverRef chromeUpdateObserver;
 
 @end
 
@@ -75,21 +101,31 @@ typedef enum {
 {
     self = [super init];
     if (self) {
+        _viewBackend = [[FRUIKitViewBackend alloc] init];
         FRLayerController *layeredRC = [[FRLayerController alloc] initWithContentViewController:rootViewController
                                                                                    maximumWidth:NO];
+        layeredRC.viewBackend = _viewBackend;
         _layeredViewControllers = [[NSMutableArray alloc] initWithArray:@[layeredRC]];
-        layeredRC.layeredNavigationItem.nextItemDistance = FRLayeredNavigationControllerStandardDistance;
-        layeredRC.layeredNavigationItem.width = FRLayeredNavigationControllerStandardWidth;
-        layeredRC.layeredNavigationItem.hasChrome = NO;
-        layeredRC.layeredNavigationItem.hasBorder = NO;
-        layeredRC.layeredNavigationItem.displayShadow = NO;
+        [FRLayeredNavigationController configureRootNavigationItem:layeredRC.layeredNavigationItem];
         configuration(layeredRC.layeredNavigationItem);
         _outOfBoundsViewController = nil;
         _userInteractionEnabled = YES;
         _dropLayersWhenPulledRight = NO;
+        _dropZoneDistance = 300;
+        _layoutCache = [[NSMutableDictionary alloc] init];
+        _screenBounds = CGRectNull;
+        _panningDirectionLockRatio = 1;
+        _panningExcludedViews = [[NSMutableArray alloc] init];
+        _panningExcludedViewClasses = [[NSMutableSet alloc] initWithObjects:[UISlider class], nil];
+
+        /* the "hidden" UITableViewCellReorderControl class */
+        Class reorderControlClass = NSClassFromString(@"UITableViewCellReorderControl");
+        if (reorderControlClass != nil) {
+            [_panningExcludedViewClasses addObject:reorderControlClass];
+        }
 
-        [self addChildViewController:layeredRC];
-        [layeredRC didMoveToParentViewController:self];
+        [_viewBackend addChildViewController:layeredRC toParentViewController:self];
+        [_viewBackend childViewController:layeredRC didMoveToParentViewController:self];
     }
     return self;
 }
@@ -97,6 +133,7 @@ typedef enum {
 - (void)dealloc
 {
     [self detachGestureRecognizer];
+    [self detachChromeUpdateObserver];
 }
 
 
@@ -105,14 +142,17 @@ typedef enum {
 - (void)loadView
 {
     self.view = [[UIView alloc] init];
+    [self applyLayerLayout:[self layerLayoutForContainerSize:CGSizeMake([self containerWidth],
+                                                                        CGRectGetHeight(self.view.bounds))]];
 
     for (FRLayerController *vc in self.layeredViewControllers) {
-        vc.view.frame = CGRectMake(vc.layeredNavigationItem.currentViewPosition.x,
-                                   vc.layeredNavigationItem.currentViewPosition.y,
-                                   vc.layeredNavigationItem.width,
-                                   CGRectGetHeight(self.view.bounds));
+        [self.viewBackend setFrame:CGRectMake(vc.layeredNavigationItem.currentViewPosition.x,
+                                              vc.layeredNavigationItem.currentViewPosition.y,
+                                              vc.layeredNavigationItem.resolvedWidth,
+                                              CGRectGetHeight(self.view.bounds))
+                           forView:vc.view];
         vc.view.autoresizingMask = UIViewAutoresizingFlexibleHeight;
-        [self.view addSubview:vc.view];
+        [self.viewBackend addSubview:vc.view toView:self.view];
     }
 }
 
@@ -123,6 +163,7 @@ typedef enum {
     if (self.userInteractionEnabled) {
         [self attachGestureRecognizer];
     }
+    [self attachChromeUpdateObserver];
     self.view.backgroundColor = [UIColor clearColor];
 }
 
@@ -130,7 +171,23 @@ typedef enum {
 {
     FRDLOG(@"ORIENTATION, new size: %@", NSStringFromCGSize(self.view.bounds.size));
     [super didRotateFromInterfaceOrientation:orientation];
+    self.screenBounds = CGRectNull;
     [self doLayout];
+    [self setNeedsThumbnailUpdateForAllLayers];
+}
+
+- (void)viewWillTransitionToSize:(CGSize)size
+       withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator
+{
+    [super viewWillTransitionToSize:size withTransitionCoordinator:coordinator];
+    self.screenBounds = CGRectNull;
+    [self setNeedsThumbnailUpdateForAllLayers];
+
+    /* move all the layers to the new layout in one animation (alongside the transition) */
+    [coordinator animateAlongsideTransition:^(__unused id<UIViewControllerTransitionCoordinatorContext> context) {
+        [self doLayoutForContainerSize:size];
+    }
+                                 completion:nil];
 }
 
 - (void)viewWillLayoutSubviews
@@ -143,11 +200,13 @@ typedef enum {
 {
     [super viewDidAppear:animated];
     [self doLayout];
+    [self scheduleThumbnailUpdate];
 }
 
 - (void)viewWillUnload
 {
     [self detachGestureRecognizer];
+    [self detachChromeUpdateObserver];
     self.firstTouchedView = nil;
     self.outOfBoundsViewController = nil;
 
@@ -180,6 +239,10 @@ typedef enum {
 
         case UIGestureRecognizerStateBegan: {
             //NSLog(@"UIGestureRecognizerStateBegan");
+
+            /* the user grabs the layers where they are on the screen right now, not where they'd end up */
+            [self settleLayerAnimations];
+
             UIView *touchedView =
                 [gestureRecognizer.view hitTest:[gestureRecognizer locationInView:gestureRecognizer.view]
                                       withEvent:nil];
@@ -217,19 +280,7 @@ typedef enum {
              */
             [gestureRecognizer setTranslation:CGPointZero inView:startVc.view];
 
-            if (self.dropLayersWhenPulledRight) {
-                if (self.dropNotificationView == nil) {
-                    if ([self layersInDropZone]) {
-                        [self showDropNotification];
-                    }
-                } else {
-                    if (![self layersInDropZone]) {
-                        [self hideDropNotification];
-                    }
-                }
-            } else {
-                [self hideDropNotification];
-            }
+            [self updateDropZone];
 
             break;
         }
@@ -237,27 +288,73 @@ typedef enum {
         case UIGestureRecognizerStateEnded: {
             //NSLog(@"UIGestureRecognizerStateEnded");
 
+            if (self.dropLayersWhenPulledRight && self.dropZoneActive) {
+                [self popToRootViewControllerAnimated:YES direction:FRLayeredAnimationDirectionRight];
+            }
+
+            self.dropZoneActive = NO;
             [self hideDropNotification];
 
-            if (self.dropLayersWhenPulledRight && [self layersInDropZone]) {
-                [self popToRootViewControllerAnimated:FRLayeredAnimationDirectionRight];
+            if ([delegate respondsToSelector:
+                 @selector(layeredNavigationController:willSnapToFrames:revealingViewControllers:)]) {
+                NSArray *revealed = nil;
+                NSArray *frames =
+                    [self predictedFramesForHorizontalVelocity:[gestureRecognizer velocityInView:self.view].x
+                                       revealedViewControllers:&revealed];
+                [delegate layeredNavigationController:self willSnapToFrames:frames revealingViewControllers:revealed];
             }
 
-            [UIView animateWithDuration:0.2 animations:^{
-                [self moveToSnappingPointsWithGestureRecognizer:gestureRecognizer];
+            [self animateLayersWithDuration:0.2
+                                    options:UIViewAnimationOptionCurveEaseInOut
+                                 animations:^{
+                                     [self moveToSnappingPointsWithGestureRecognizer:gestureRecognizer];
+                                 }
+                                 completion:^(__unused BOOL finished) {
+            if (gestureRecognizer.state == UIGestureRecognizerStateBegan ||
+                gestureRecognizer.state == UIGestureRecognizerStateChanged) {
+                /* interrupted by a new pan which took over from the current on-screen position */
+                return;
             }
-                             completion:^(__unused BOOL finished) {
+
             if ([delegate respondsToSelector:@selector(layeredNavigationController:didMoveController:)]) {
                 [delegate layeredNavigationController:self didMoveController:self.firstTouchedController];
             }
 
             self.firstTouchedView = nil;
             self.firstTouchedController = nil;
+            [self scheduleThumbnailUpdate];
             }];
 
             break;
         }
 
+        case UIGestureRecognizerStateCancelled:
+        case UIGestureRecognizerStateFailed: {
+            //NSLog(@"UIGestureRecognizerStateCancelled");
+
+            /* a cancelled pan never drops the layers but the indicator mustn't stay */
+            self.dropZoneActive = NO;
+            [self hideDropNotification];
+
+            /* no meaningful velocity, just settle on the nearest snapping points */
+            [self animateLayersWithDuration:0.2
+                                    options:UIViewAnimationOptionCurveEaseInOut
+                                 animations:^{
+                                     [self viewControllersToSnappingPointsMethod:SnappingPointsMethodNearest];
+                                 }
+                                 completion:nil];
+
+            if (self.firstTouchedView != nil &&
+                [delegate respondsToSelector:@selector(layeredNavigationController:didMoveController:)]) {
+                [delegate layeredNavigationController:self didMoveController:firstTouchedController];
+            }
+
+            self.firstTouchedView = nil;
+            self.firstTouchedController = nil;
+            [self scheduleThumbnailUpdate];
+            break;
+        }
+
         default:
             break;
     }
@@ -265,32 +362,149 @@ typedef enum {
 
 - (BOOL)gestureRecognizer:(__unused UIGestureRecognizer *)gestureRecognizer shouldReceiveTouch:(UITouch *)touch
 {
-    /* get a static reference to the "hidden" UITableViewCellReorderControl class */
-    static Class reorderControlClass = nil;
-    if (reorderControlClass == nil) {
-        reorderControlClass = NSClassFromString(@"UITableViewCellReorderControl");
+    if (self.overviewVisible) {
+        /* the overview covers the layers, its scroll view mustn't drag them */
+        return NO;
     }
 
-    if ([touch.view isKindOfClass:[UISlider class]] ||
-        [touch.view isKindOfClass:reorderControlClass]) {
-        // prevent recognizing touches on the slider / table view reorder control
-        return NO;
+    return [self panningAllowedForView:touch.view];
+}
+
+- (BOOL)gestureRecognizerShouldBegin:(UIGestureRecognizer *)gestureRecognizer
+{
+    if (gestureRecognizer != self.panGR || self.panningDirectionLockRatio <= 0) {
+        return YES;
     }
-    return YES;
+
+    /* vertical movements (scroll views) shouldn't move the layers */
+    const CGPoint velocity = [self.panGR velocityInView:self.view];
+    return fabs(velocity.x) >= self.panningDirectionLockRatio * fabs(velocity.y);
 }
 
 #pragma mark - internal methods
 
-+ (void)viewControllerToInitialPosition:(FRLayerController *)vc
++ (void)configureRootNavigationItem:(FRLayeredNavigationItem *)navItem
+{
+    navItem.nextItemDistance = FRLayeredNavigationControllerStandardDistance;
+    navItem.width = FRLayeredNavigationControllerStandardWidth;
+    navItem.hasChrome = NO;
+    navItem.hasBorder = NO;
+    navItem.displayShadow = NO;
+}
+
++ (void)configurePushedNavigationItem:(FRLayeredNavigationItem *)navItem
+{
+    navItem.titleView = nil;
+    navItem.title = nil;
+    navItem.hasChrome = YES;
+    navItem.displayShadow = YES;
+}
+
+- (FRLayerController *)layerControllerWithContentViewController:(UIViewController *)contentViewController
+                                                   maximumWidth:(BOOL)maxWidth
+{
+    FRLayerController *layerController =
+        [[FRLayerController alloc] initWithContentViewController:contentViewController maximumWidth:maxWidth];
+    layerController.viewBackend = self.viewBackend;
+    return layerController;
+}
+
+- (CGFloat)containerWidth
+{
+    return ((CGRectGetWidth(self.view.bounds) > 0) ?
+            CGRectGetWidth(self.view.bounds) :
+            CGRectGetWidth([self getScreenBoundsForCurrentOrientation]));
+}
+
+- (CGFloat)containerHeight
+{
+    return ((CGRectGetHeight(self.view.bounds) > 0) ?
+            CGRectGetHeight(self.view.bounds) :
+            CGRectGetHeight([self getScreenBoundsForCurrentOrientation]));
+}
+
+- (void)animateLayersWithDuration:(NSTimeInterval)duration
+                          options:(UIViewAnimationOptions)options
+                       animations:(void (^)(void))animations
+                       completion:(void (^)(BOOL finished))completion
+{
+    /* all layer movements start from what's on the screen, so they can interrupt each other without jumps */
+    self.runningLayerAnimations++;
+    [self.viewBackend animateWithDuration:duration
+                                    delay:0
+                                  options:(options |
+                                           UIViewAnimationOptionBeginFromCurrentState |
+                                           UIViewAnimationOptionAllowUserInteraction)
+                               animations:animations
+                               completion:^(BOOL finished) {
+                                   self.runningLayerAnimations--;
+                                   if (completion != nil) {
+                                       completion(finished);
+                                   }
+                               }];
+}
+
+- (void)settleLayerAnimations
+{
+    if (self.runningLayerAnimations == 0) {
+        return;
+    }
+
+    /* stop the layers where they currently are on the screen and make that their model position */
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        const CGRect presentationFrame = [self.viewBackend presentationFrameOfView:vc.view];
+        FRLayeredNavigationItem *navItem = vc.layeredNavigationItem;
+
+        [self.viewBackend removeAnimationsOfView:vc.view];
+        if (!CGRectEqualToRect(presentationFrame, vc.view.frame)) {
+            /* the layers which weren't moving are already there */
+            [self.viewBackend setFrame:presentationFrame forView:vc.view];
+        }
+        navItem.currentViewPosition = CGPointMake(MAX(CGRectGetMinX(presentationFrame),
+                                                      navItem.initialViewPosition.x),
+                                                  CGRectGetMinY(presentationFrame));
+    }
+}
+
+- (BOOL)isViewExcludedFromPanning:(UIView *)view
+{
+    for (FRLayeredNavigationWeakReference *reference in self.panningExcludedViews) {
+        if (reference.object == view) {
+            return YES;
+        }
+    }
+
+    return NO;
+}
+
+- (BOOL)panningAllowedForView:(UIView *)view
+{
+    for (UIView *here = view; here != nil && here != self.view; here = here.superview) {
+        if ([self isViewExcludedFromPanning:here]) {
+            return NO;
+        }
+
+        for (Class excludedClass in self.panningExcludedViewClasses) {
+            if ([here isKindOfClass:excludedClass]) {
+                /* prevent recognizing touches on sliders, table view reorder controls, ... */
+                return NO;
+            }
+        }
+    }
+
+    return YES;
+}
+
+- (void)viewControllerToInitialPosition:(FRLayerController *)vc
 {
     const CGPoint initPos = vc.layeredNavigationItem.initialViewPosition;
     CGRect f = vc.view.frame;
     f.origin = initPos;
     vc.layeredNavigationItem.currentViewPosition = initPos;
-    vc.view.frame = f;
+    [self.viewBackend setFrame:f forView:vc.view];
 }
 
-+ (BOOL)viewController:(FRLayerController *)vc xTranslation:(CGFloat)origXTranslation bounded:(BOOL)bounded
+- (BOOL)viewController:(FRLayerController *)vc xTranslation:(CGFloat)origXTranslation bounded:(BOOL)bounded
 {
     BOOL didMoveOutOfBounds = NO;
     const FRLayeredNavigationItem *navItem = vc.layeredNavigationItem;
@@ -306,7 +520,10 @@ typedef enum {
             f.origin.x = initPos.x;
         }
 
-        vc.view.frame = f;
+        /* layers which already are at their bound don't move */
+        if (!CGRectEqualToRect(f, vc.view.frame)) {
+            [self.viewBackend setFrame:f forView:vc.view];
+        }
         navItem.currentViewPosition = f.origin;
     } else {
         CGFloat xTranslation;
@@ -326,7 +543,9 @@ typedef enum {
         } else {
             navItem.currentViewPosition = f.origin;
         }
-        vc.view.frame = f;
+        if (!CGRectEqualToRect(f, vc.view.frame)) {
+            [self.viewBackend setFrame:f forView:vc.view];
+        }
     }
     return didMoveOutOfBounds;
 }
@@ -344,16 +563,31 @@ typedef enum {
     return maximalCompression;
 }
 
-- (void)viewControllersToSnappingPointsMethod:(SnappingPointsMethod)method
++ (SnappingPointsMethod)snappingPointsMethodForVelocity:(CGFloat)velocity
+{
+    if (fabs(velocity) > FRLayeredNavigationControllerSnappingVelocityThreshold) {
+        if (velocity > 0) {
+            return SnappingPointsMethodExpand;
+        } else {
+            return SnappingPointsMethodCompact;
+        }
+    } else {
+        return SnappingPointsMethodNearest;
+    }
+}
+
+- (NSArray *)snappingPositionsForMethod:(SnappingPointsMethod)method
 {
+    NSMutableArray *positions = [NSMutableArray arrayWithCapacity:[self.layeredViewControllers count]];
     FRLayerController *last = nil;
+    CGPoint lastPos = CGPointZero;
     CGFloat xTranslation = 0;
 
     for (FRLayerController *vc in self.layeredViewControllers) {
         const CGPoint myPos = vc.layeredNavigationItem.currentViewPosition;
         const CGPoint myInitPos = vc.layeredNavigationItem.initialViewPosition;
 
-        const CGFloat curDiff = myPos.x - last.layeredNavigationItem.currentViewPosition.x;
+        const CGFloat curDiff = myPos.x - lastPos.x;
         const CGFloat initDiff = myInitPos.x - last.layeredNavigationItem.initialViewPosition.x;
         const CGFloat maxDiff = ((last.layeredNavigationItem.snappingDistance >= 0) ?
                                  last.layeredNavigationItem.snappingDistance :
@@ -382,26 +616,85 @@ typedef enum {
             }
         }
 
-        [FRLayeredNavigationController viewController:vc xTranslation:xTranslation bounded:YES];
+        /* same as a bounded translation: never further left than the initial position */
+        CGPoint newPos = myPos;
+        newPos.x += xTranslation;
+        if (newPos.x <= myInitPos.x) {
+            newPos.x = myInitPos.x;
+        }
+
+        [positions addObject:[NSValue valueWithCGPoint:newPos]];
         last = vc;
+        lastPos = newPos;
     }
+
+    return positions;
 }
 
-- (void)moveToSnappingPointsWithGestureRecognizer:(UIPanGestureRecognizer *)g
+- (NSArray *)framesForPositions:(NSArray *)positions
 {
-    const CGFloat velocity = [g velocityInView:self.view].x;
-    SnappingPointsMethod method;
+    NSMutableArray *frames = [NSMutableArray arrayWithCapacity:[positions count]];
 
-    if (fabs(velocity) > FRLayeredNavigationControllerSnappingVelocityThreshold) {
-        if (velocity > 0) {
-            method = SnappingPointsMethodExpand;
-        } else {
-            method = SnappingPointsMethodCompact;
+    [self.layeredViewControllers enumerateObjectsUsingBlock:^(FRLayerController *vc, NSUInteger idx, __unused BOOL *s) {
+        CGRect f = vc.view.frame;
+        f.origin = [[positions objectAtIndex:idx] CGPointValue];
+        [frames addObject:[NSValue valueWithCGRect:f]];
+    }];
+
+    return frames;
+}
+
+- (CGFloat)visibleWidthOfLayerAtIndex:(NSUInteger)idx frames:(NSArray *)frames
+{
+    const CGRect f = [[frames objectAtIndex:idx] CGRectValue];
+    CGFloat visibleMaxX = MIN(CGRectGetMaxX(f), CGRectGetWidth(self.view.bounds));
+
+    if (idx + 1 < [frames count]) {
+        visibleMaxX = MIN(visibleMaxX, CGRectGetMinX([[frames objectAtIndex:idx + 1] CGRectValue]));
+    }
+
+    return MAX(0, visibleMaxX - MAX(CGRectGetMinX(f), 0));
+}
+
+- (NSArray *)viewControllersRevealedFromFrames:(NSArray *)oldFrames toFrames:(NSArray *)newFrames
+{
+    NSMutableArray *revealed = [NSMutableArray array];
+
+    for (NSUInteger i = 0; i < [newFrames count]; i++) {
+        const CGFloat oldVisible = [self visibleWidthOfLayerAtIndex:i frames:oldFrames];
+        const CGFloat newVisible = [self visibleWidthOfLayerAtIndex:i frames:newFrames];
+
+        if (newVisible > oldVisible && CGFloatNotEqual(newVisible, oldVisible)) {
+            const FRLayerController *vc = [self.layeredViewControllers objectAtIndex:i];
+            [revealed addObject:vc.contentViewController];
         }
-    } else {
-        method = SnappingPointsMethodNearest;
     }
 
+    return revealed;
+}
+
+- (void)viewControllersToSnappingPointsMethod:(SnappingPointsMethod)method
+{
+    NSArray *positions = [self snappingPositionsForMethod:method];
+
+    [self.layeredViewControllers enumerateObjectsUsingBlock:^(FRLayerController *vc, NSUInteger idx, __unused BOOL *s) {
+        const CGPoint newPos = [[positions objectAtIndex:idx] CGPointValue];
+        CGRect f = vc.view.frame;
+        f.origin = newPos;
+        vc.layeredNavigationItem.currentViewPosition = newPos;
+
+        /* usually only the layers in front of the touched one snap, the others stay where they are */
+        if (!CGRectEqualToRect(f, vc.view.frame)) {
+            [self.viewBackend setFrame:f forView:vc.view];
+        }
+    }];
+}
+
+- (void)moveToSnappingPointsWithGestureRecognizer:(UIPanGestureRecognizer *)g
+{
+    const CGFloat velocity = [g velocityInView:self.view].x;
+    const SnappingPointsMethod method = [FRLayeredNavigationController snappingPointsMethodForVelocity:velocity];
+
     [self viewControllersToSnappingPointsMethod:method];
 }
 
@@ -466,9 +759,9 @@ typedef enum {
              * OR the translation goes to the left again
              * THEN: apply the translation
              */
-            const BOOL outOfBoundsMove = [FRLayeredNavigationController viewController:me
-                                                                          xTranslation:xTranslation
-                                                                               bounded:boundedMove];
+            const BOOL outOfBoundsMove = [self viewController:me
+                                                 xTranslation:xTranslation
+                                                      bounded:boundedMove];
             if (outOfBoundsMove) {
                 /* this move was out of bounds */
                 self.outOfBoundsViewController = me;
@@ -479,7 +772,7 @@ typedef enum {
                  * - discard the rest of the translation
                  */
                 self.outOfBoundsViewController = nil;
-                [FRLayeredNavigationController viewControllerToInitialPosition:me];
+                [self viewControllerToInitialPosition:me];
                 break; /* this discards the rest of the translation (i.e. stops the loop) */
             }
         }
@@ -519,36 +812,89 @@ typedef enum {
         if (vc == [self.layeredViewControllers lastObject]) {
             break;
         }
-        [FRLayeredNavigationController viewController:vc xTranslation:xTranslation bounded:YES];
+        [self viewController:vc xTranslation:xTranslation bounded:YES];
     }
     return fabs(xTranslation);
 }
 
 
+- (void)invalidateLayoutCache
+{
+    [self.layoutCache removeAllObjects];
+}
+
+- (void)setNeedsLayerLayout
+{
+    [self invalidateLayoutCache];
+
+    if ([self isViewLoaded]) {
+        [self.view setNeedsLayout];
+    }
+}
+
+- (NSArray *)layerLayoutForContainerSize:(CGSize)size
+{
+    /* the layout only depends on the stack, the layers' width settings and the container size */
+    NSValue *key = [NSValue valueWithCGSize:size];
+    NSArray *frames = [self.layoutCache objectForKey:key];
+
+    if (frames == nil) {
+        frames = [FRLayerLayoutSolver initialFramesOfLayerControllers:self.layeredViewControllers containerSize:size];
+        [self.layoutCache setObject:frames forKey:key];
+    }
+
+    return frames;
+}
+
+- (void)applyLayerLayout:(NSArray *)frames
+{
+    /* push, doLayout and setViewControllers: all position the layers according to the solver's result */
+    [self.layeredViewControllers enumerateObjectsUsingBlock:^(FRLayerController *vc, NSUInteger idx, __unused BOOL *s) {
+        FRLayeredNavigationItem *navItem = vc.layeredNavigationItem;
+        const CGRect f = [[frames objectAtIndex:idx] CGRectValue];
+
+        navItem.initialViewPosition = f.origin;
+        navItem.resolvedWidth = CGRectGetWidth(f);
+        if (vc.maximumWidth) {
+            navItem.width = CGRectGetWidth(f);
+        }
+    }];
+}
+
 - (void)doLayout
 {
+    [self doLayoutForContainerSize:self.view.bounds.size];
+}
+
+- (void)doLayoutForContainerSize:(CGSize)size
+{
+    [self applyLayerLayout:[self layerLayoutForContainerSize:size]];
+
     for (FRLayerController *vc in self.layeredViewControllers) {
+        FRLayeredNavigationItem *navItem = vc.layeredNavigationItem;
         CGRect f = vc.view.frame;
-        if (vc.layeredNavigationItem.currentViewPosition.x < vc.layeredNavigationItem.initialViewPosition.x) {
-            vc.layeredNavigationItem.currentViewPosition = vc.layeredNavigationItem.initialViewPosition;
+        if (navItem.currentViewPosition.x < navItem.initialViewPosition.x) {
+            navItem.currentViewPosition = navItem.initialViewPosition;
         }
-        f.origin = vc.layeredNavigationItem.currentViewPosition;
+        f.origin = navItem.currentViewPosition;
+        f.size.width = navItem.resolvedWidth;
+        f.size.height = size.height;
 
-        if (vc.maximumWidth) {
-            f.size.width = CGRectGetWidth(self.view.bounds) - vc.layeredNavigationItem.initialViewPosition.x;
-            vc.layeredNavigationItem.width = CGRectGetWidth(f);
+        if (!CGRectEqualToRect(f, vc.view.frame)) {
+            [self.viewBackend setFrame:f forView:vc.view];
         }
-
-        f.size.height = CGRectGetHeight(self.view.bounds);
-
-        vc.view.frame = f;
     }
 }
 
 - (CGRect)getScreenBoundsForCurrentOrientation
 {
-    UIInterfaceOrientation orientation = [[UIApplication sharedApplication] statusBarOrientation];
-    return [FRLayeredNavigationController getScreenBoundsForOrientation:orientation];
+    if (CGRectIsNull(self.screenBounds)) {
+        /* only changes on rotation, reset in didRotateFromInterfaceOrientation: & viewWillTransitionToSize:... */
+        UIInterfaceOrientation orientation = [[UIApplication sharedApplication] statusBarOrientation];
+        self.screenBounds = [FRLayeredNavigationController getScreenBoundsForOrientation:orientation];
+    }
+
+    return self.screenBounds;
 }
 
 + (CGRect)getScreenBoundsForOrientation:(UIInterfaceOrientation)orientation
@@ -583,6 +929,50 @@ typedef enum {
     self.panGR = nil;
 }
 
+- (void)attachChromeUpdateObserver
+{
+    if (self.chromeUpdateObserver != NULL) {
+        return;
+    }
+
+    /* once per run loop iteration, before Core Animation commits */
+    FRLayeredNavigationController __weak *weakSelf = self;
+    self.chromeUpdateObserver =
+        CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault,
+                                           kCFRunLoopBeforeWaiting,
+                                           true,
+                                           0,
+                                           ^(__unused CFRunLoopObserverRef observer,
+                                             __unused CFRunLoopActivity activity) {
+                                               [weakSelf updateVisibleLayerChromes];
+                                           });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), self.chromeUpdateObserver, kCFRunLoopCommonModes);
+}
+
+- (void)detachChromeUpdateObserver
+{
+    if (self.chromeUpdateObserver != NULL) {
+        CFRunLoopObserverInvalidate(self.chromeUpdateObserver);
+        CFRelease(self.chromeUpdateObserver);
+        self.chromeUpdateObserver = NULL;
+    }
+}
+
+- (void)updateVisibleLayerChromes
+{
+    if (![self isViewLoaded] || self.view.window == nil) {
+        return;
+    }
+
+    const CGRect bounds = self.view.bounds;
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        /* off-screen layers get updated as soon as they become visible */
+        if ([vc isViewLoaded] && CGRectIntersectsRect(vc.view.frame, bounds)) {
+            [vc updateChromeTitle];
+        }
+    }
+}
+
 - (FRLayerController *)layerControllerOf:(UIViewController *)vc
 {
     for (FRLayerController *lvc in self.layeredViewControllers) {
@@ -593,7 +983,7 @@ typedef enum {
     return nil;
 }
 
-- (BOOL)layersInDropZone
+- (CGFloat)dropZonePullDistance
 {
     if ([self.layeredViewControllers count] > 1) {
         const FRLayerController *rootVC = [self.layeredViewControllers objectAtIndex:0];
@@ -601,12 +991,34 @@ typedef enum {
         const FRLayeredNavigationItem *rootNI = rootVC.layeredNavigationItem;
         const FRLayeredNavigationItem *layer1NI = layer1VC.layeredNavigationItem;
 
-        if (layer1NI.currentViewPosition.x - rootNI.currentViewPosition.x - rootNI.width > 300) {
-            return YES;
+        return layer1NI.currentViewPosition.x - rootNI.currentViewPosition.x - rootNI.resolvedWidth;
+    }
+
+    return -CGFLOAT_MAX;
+}
+
+- (void)updateDropZone
+{
+    BOOL active = NO;
+
+    if (self.dropLayersWhenPulledRight) {
+        /* hysteresis: leaving the drop zone needs a bit more movement than entering, so no flickering */
+        const CGFloat distance = [self dropZonePullDistance];
+        if (self.dropZoneActive) {
+            active = distance > self.dropZoneDistance - FRLayeredNavigationControllerDropZoneHysteresis;
+        } else {
+            active = distance > self.dropZoneDistance;
         }
     }
 
-    return NO;
+    if (active != self.dropZoneActive) {
+        self.dropZoneActive = active;
+        if (active) {
+            [self showDropNotification];
+        } else {
+            [self hideDropNotification];
+        }
+    }
 }
 
 - (void)showDropNotification
@@ -615,24 +1027,81 @@ typedef enum {
     const FRLayeredNavigationItem *rootNI = rootVC.layeredNavigationItem;
     UIView *dropNotificationView = self.dropNotificationView;
 
-    UILabel *lv = [[UILabel alloc] init];
-    lv.text = @"X";
-    lv.backgroundColor = [UIColor clearColor];
-    lv.textColor = [UIColor redColor];
-    lv.frame = CGRectMake(rootNI.currentViewPosition.x + rootNI.width + 10,
-                          (CGRectGetHeight(self.view.bounds)-100)/2,
-                          100,
-                          100);
-    self.dropNotificationView = lv;
-    [self.view insertSubview:dropNotificationView atIndex:0];
+    if (dropNotificationView == nil) {
+        /* allocated once and then only shown/hidden */
+        UILabel *lv = [[UILabel alloc] init];
+        lv.text = @"X";
+        lv.backgroundColor = [UIColor clearColor];
+        lv.textColor = [UIColor redColor];
+        [self.viewBackend setHidden:YES forView:lv];
+        dropNotificationView = lv;
+        self.dropNotificationView = dropNotificationView;
+        [self.viewBackend insertSubview:dropNotificationView intoView:self.view atIndex:0];
+    }
+
+    const CGRect f = CGRectMake(rootNI.currentViewPosition.x + rootNI.resolvedWidth + 10,
+                                (CGRectGetHeight(self.view.bounds)-100)/2,
+                                100,
+                                100);
+    if (!CGRectEqualToRect(f, dropNotificationView.frame)) {
+        [self.viewBackend setFrame:f forView:dropNotificationView];
+    }
+    [self.viewBackend setHidden:NO forView:dropNotificationView];
 }
 
 - (void)hideDropNotification
 {
     UIView *dropNotificationView = self.dropNotificationView;
+
     if (dropNotificationView != nil) {
-        [dropNotificationView removeFromSuperview];
-        self.dropNotificationView = nil;
+        [self.viewBackend setHidden:YES forView:dropNotificationView];
+    }
+}
+
+- (void)setNeedsThumbnailUpdateForAllLayers
+{
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        [vc setNeedsThumbnailUpdate];
+    }
+    [self scheduleThumbnailUpdate];
+}
+
+- (void)scheduleThumbnailUpdate
+{
+    /* thumbnails only get rendered for the overview, nobody pays for them who never shows it */
+    if (self.overviewVisible && !self.thumbnailUpdateScheduled) {
+        self.thumbnailUpdateScheduled = YES;
+        [self performSelector:@selector(updateNextThumbnail) withObject:nil afterDelay:0];
+    }
+}
+
+- (void)updateNextThumbnail
+{
+    self.thumbnailUpdateScheduled = NO;
+
+    if (!self.overviewVisible) {
+        /* hidden in the meantime, rescheduled when it gets shown again */
+        return;
+    }
+
+    if (self.firstTouchedView != nil) {
+        /* don't compete with the user moving the layers, rescheduled when the gesture ended */
+        return;
+    }
+
+    /* only one layer per run loop turn to keep the main thread responsive */
+    const CGFloat thumbnailScale = FRLayeredNavigationControllerThumbnailScale * [UIScreen mainScreen].scale;
+    __block BOOL updated = NO;
+    [self.layeredViewControllers enumerateObjectsUsingBlock:^(FRLayerController *vc, NSUInteger idx, BOOL *stop) {
+        if (vc.thumbnailNeedsUpdate && [vc updateThumbnailWithScale:thumbnailScale]) {
+            [self.overviewView setThumbnail:vc.thumbnail forLayerAtIndex:idx];
+            updated = YES;
+            *stop = YES;
+        }
+    }];
+
+    if (updated) {
+        [self scheduleThumbnailUpdate];
     }
 }
 
@@ -652,7 +1121,10 @@ typedef enum {
         return;
     }
 
+    [self hideOverviewAnimated:NO];
+
     [self.layeredViewControllers removeObject:vc];
+    [self invalidateLayoutCache];
 
     CGRect goAwayFrame = CGRectMake(CGRectGetMinX(vc.view.frame),
                                     CGRectGetMinY(vc.view.frame),
@@ -662,16 +1134,16 @@ typedef enum {
     if (animated) {
         switch (direction) {
             case FRLayeredAnimationDirectionDown:
-                goAwayFrame.origin.y = 1024;
+                goAwayFrame.origin.y = [self containerHeight];
                 break;
             case FRLayeredAnimationDirectionLeft:
-                goAwayFrame.origin.x = -1024;
+                goAwayFrame.origin.x = -CGRectGetWidth(goAwayFrame);
                 break;
             case FRLayeredAnimationDirectionUp:
-                goAwayFrame.origin.y = -1024;
+                goAwayFrame.origin.y = -CGRectGetHeight(goAwayFrame);
                 break;
             case FRLayeredAnimationDirectionRight:
-                goAwayFrame.origin.x = 1024;
+                goAwayFrame.origin.x = [self containerWidth];
                 break;
             default:
                 break;
@@ -679,21 +1151,20 @@ typedef enum {
     }
 
     void (^completeViewRemoval)(BOOL) = ^(__unused BOOL finished) {
-        [vc willMoveToParentViewController:nil];
+        [self.viewBackend childViewController:vc willMoveToParentViewController:nil];
 
-        [vc.view removeFromSuperview];
+        [self.viewBackend removeViewFromSuperview:vc.view];
 
-        [vc removeFromParentViewController];
+        [self.viewBackend removeChildViewControllerFromParentViewController:vc];
     };
 
     if (animated) {
-        [UIView animateWithDuration:0.5
-                              delay:0
-                            options:UIViewAnimationOptionCurveLinear
-                         animations:^{
-                             vc.view.frame = goAwayFrame;
-                         }
-                         completion:completeViewRemoval];
+        [self animateLayersWithDuration:0.5
+                                options:UIViewAnimationOptionCurveLinear
+                             animations:^{
+                                 [self.viewBackend setFrame:goAwayFrame forView:vc.view];
+                             }
+                             completion:completeViewRemoval];
     } else {
         completeViewRemoval(YES);
     }
@@ -744,8 +1215,11 @@ typedef enum {
              configuration:(void (^)(FRLayeredNavigationItem *item))configuration
                  direction:(FRLayeredAnimationDirection)direction
 {
-    FRLayerController *newVC =
-        [[FRLayerController alloc] initWithContentViewController:contentViewController maximumWidth:maxWidth];
+    /* the overview shows the stack as it was, the new layer would end up on top of it */
+    [self hideOverviewAnimated:NO];
+
+    FRLayerController *newVC = [self layerControllerWithContentViewController:contentViewController
+                                                                 maximumWidth:maxWidth];
     const FRLayerController *parentLayerController = [self layerControllerOf:anchorViewController];
 
     if (parentLayerController == nil) {
@@ -771,38 +1245,29 @@ typedef enum {
         [self popToViewController:anchorViewController animated:direction];
     }
 
-    CGFloat anchorInitX = parentNavItem.initialViewPosition.x;
-    CGFloat anchorCurrentX = parentNavItem.currentViewPosition.x;
-    CGFloat anchorWidth = parentNavItem.width;
-    CGFloat initX = anchorInitX + ((parentNavItem.nextItemDistance >= 0) ?
-                                   parentNavItem.nextItemDistance :
-                                   FRLayeredNavigationControllerStandardDistance);
-    navItem.initialViewPosition = CGPointMake(initX, 0);
-    navItem.currentViewPosition = CGPointMake(anchorCurrentX + anchorWidth, 0);
-    navItem.titleView = nil;
-    navItem.title = nil;
-    navItem.hasChrome = YES;
-    navItem.displayShadow = YES;
+    [FRLayeredNavigationController configurePushedNavigationItem:newVC.layeredNavigationItem];
 
     configuration(newVC.layeredNavigationItem);
 
-    const CGFloat overallWidth = ((CGRectGetWidth(self.view.bounds) > 0) ?
-                                  CGRectGetWidth(self.view.bounds) :
-                                  CGRectGetWidth([self getScreenBoundsForCurrentOrientation]));
-
-    CGFloat width;
-    if (navItem.width > 0) {
-        width = navItem.width;
-    } else {
-        width = newVC.maximumWidth ? overallWidth - initX : FRLayeredNavigationControllerStandardWidth;
-        navItem.width = width;
+    if (navItem.width <= 0) {
+        navItem.width = FRLayeredNavigationControllerStandardWidth;
     }
 
+    [self.layeredViewControllers addObject:newVC];
+    [self invalidateLayoutCache];
+
+    /* the same layout doLayout applies later on, the new layer starts right in front of its (resolved) anchor */
+    const CGFloat overallWidth = [self containerWidth];
+    [self applyLayerLayout:[self layerLayoutForContainerSize:CGSizeMake(overallWidth,
+                                                                        CGRectGetHeight(self.view.bounds))]];
+    const CGFloat width = navItem.resolvedWidth;
+    navItem.currentViewPosition = CGPointMake(parentNavItem.currentViewPosition.x + parentNavItem.resolvedWidth, 0);
+
     CGRect onscreenFrame = CGRectMake(newVC.layeredNavigationItem.currentViewPosition.x,
                                       newVC.layeredNavigationItem.currentViewPosition.y,
                                       width,
                                       CGRectGetHeight(self.view.bounds));
-    CGRect offscreenFrame = CGRectMake(MAX(1024, CGRectGetMinX(onscreenFrame)),
+    CGRect offscreenFrame = CGRectMake(MAX(overallWidth, CGRectGetMinX(onscreenFrame)),
                                        0,
                                        CGRectGetWidth(onscreenFrame),
                                        CGRectGetHeight(onscreenFrame));
@@ -810,48 +1275,48 @@ typedef enum {
     if (animated) {
         switch (direction) {
             case FRLayeredAnimationDirectionDown:
-                offscreenFrame.origin.y = MAX(1024, CGRectGetMinY(onscreenFrame));
+                offscreenFrame.origin.y = MAX([self containerHeight], CGRectGetMinY(onscreenFrame));
                 break;
             case FRLayeredAnimationDirectionLeft:
-                offscreenFrame.origin.x = MIN(-1024, CGRectGetMinX(onscreenFrame));
+                offscreenFrame.origin.x = MIN(-CGRectGetWidth(onscreenFrame), CGRectGetMinX(onscreenFrame));
                 break;
             case FRLayeredAnimationDirectionUp:
-                offscreenFrame.origin.y = MIN(-1024, CGRectGetMinY(onscreenFrame));
+                offscreenFrame.origin.y = MIN(-CGRectGetHeight(onscreenFrame), CGRectGetMinY(onscreenFrame));
                 break;
             case FRLayeredAnimationDirectionRight:
-                offscreenFrame.origin.x = MAX(1024, CGRectGetMinX(onscreenFrame));
+                offscreenFrame.origin.x = MAX(overallWidth, CGRectGetMinX(onscreenFrame));
                 break;
         }
     }
 
-    newVC.view.frame = offscreenFrame;
+    [self.viewBackend setFrame:offscreenFrame forView:newVC.view];
 
-    [self.layeredViewControllers addObject:newVC];
-    [self addChildViewController:newVC];
-    [self.view addSubview:newVC.view];
+    [self.viewBackend addChildViewController:newVC toParentViewController:self];
+    [self.viewBackend addSubview:newVC.view toView:self.view];
 
     void (^doNewFrameMove)() = ^() {
         CGFloat saved = [self savePlaceWanted:CGRectGetMinX(onscreenFrame)+width-overallWidth];
-        newVC.view.frame = CGRectMake(CGRectGetMinX(onscreenFrame) - saved,
-                                      CGRectGetMinY(onscreenFrame),
-                                      CGRectGetWidth(onscreenFrame),
-                                      CGRectGetHeight(onscreenFrame));
-        newVC.layeredNavigationItem.currentViewPosition = newVC.view.frame.origin;
+        const CGRect newFrame = CGRectMake(CGRectGetMinX(onscreenFrame) - saved,
+                                           CGRectGetMinY(onscreenFrame),
+                                           CGRectGetWidth(onscreenFrame),
+                                           CGRectGetHeight(onscreenFrame));
+        [self.viewBackend setFrame:newFrame forView:newVC.view];
+        newVC.layeredNavigationItem.currentViewPosition = newFrame.origin;
     };
     void (^newFrameMoveCompleted)(BOOL) = ^(__unused BOOL finished) {
-        [newVC didMoveToParentViewController:self];
+        [self.viewBackend childViewController:newVC didMoveToParentViewController:self];
+        [self scheduleThumbnailUpdate];
     };
 
     if (animated) {
-        [UIView animateWithDuration:0.5
-                              delay:0
-                            options:UIViewAnimationOptionCurveEaseOut
-                         animations:^{
-                             doNewFrameMove();
-                         }
-                         completion:^(BOOL finished) {
-                             newFrameMoveCompleted(finished);
-                         }];
+        [self animateLayersWithDuration:0.5
+                                options:UIViewAnimationOptionCurveEaseOut
+                             animations:^{
+                                 doNewFrameMove();
+                             }
+                             completion:^(BOOL finished) {
+                                 newFrameMoveCompleted(finished);
+                             }];
     } else {
         doNewFrameMove();
         newFrameMoveCompleted(YES);
@@ -886,6 +1351,132 @@ typedef enum {
                    direction:FRLayeredAnimationDirectionRight];
 }
 
+- (void)setViewControllers:(NSArray *)viewControllers
+            configurations:(NSArray *)configurations
+                  animated:(BOOL)animated
+{
+    [self setViewControllers:viewControllers maximumWidths:nil configurations:configurations animated:animated];
+}
+
+- (void)setViewControllers:(NSArray *)viewControllers
+             maximumWidths:(NSArray *)maximumWidths
+            configurations:(NSArray *)configurations
+                  animated:(BOOL)animated
+{
+    NSAssert([viewControllers count] > 0, @"at least the root view controller is needed");
+
+    BOOL (^maximumWidthAtIndex)(NSUInteger) = ^BOOL(NSUInteger idx) {
+        /* like in initWithRootViewController:, the root layer never has the maximum width */
+        return idx > 0 && idx < [maximumWidths count] && [[maximumWidths objectAtIndex:idx] boolValue];
+    };
+
+    /* layers already showing the right view controllers at the right place with the right width are kept */
+    NSUInteger keptLayers = 0;
+    while (keptLayers < MIN([viewControllers count], [self.layeredViewControllers count])) {
+        const FRLayerController *layer = [self.layeredViewControllers objectAtIndex:keptLayers];
+
+        if (layer.contentViewController != [viewControllers objectAtIndex:keptLayers] ||
+            layer.maximumWidth != maximumWidthAtIndex(keptLayers)) {
+            break;
+        }
+        keptLayers++;
+    }
+
+    [self hideOverviewAnimated:NO];
+
+    NSRange removedRange = NSMakeRange(keptLayers, [self.layeredViewControllers count] - keptLayers);
+    NSArray *removedLayers = [self.layeredViewControllers subarrayWithRange:removedRange];
+    [self.layeredViewControllers removeObjectsInRange:removedRange];
+
+    NSMutableArray *addedLayers = [NSMutableArray arrayWithCapacity:[viewControllers count] - keptLayers];
+    for (NSUInteger i = keptLayers; i < [viewControllers count]; i++) {
+        FRLayerController *newVC = [self layerControllerWithContentViewController:[viewControllers objectAtIndex:i]
+                                                                     maximumWidth:maximumWidthAtIndex(i)];
+        FRLayeredNavigationItem *navItem = newVC.layeredNavigationItem;
+        const FRLayerController *parentLayerController = [self.layeredViewControllers lastObject];
+
+        if (parentLayerController == nil) {
+            [FRLayeredNavigationController configureRootNavigationItem:navItem];
+        } else {
+            [FRLayeredNavigationController configurePushedNavigationItem:navItem];
+        }
+
+        if (i < [configurations count] && [configurations objectAtIndex:i] != [NSNull null]) {
+            void (^configuration)(FRLayeredNavigationItem *item) = [configurations objectAtIndex:i];
+            configuration(navItem);
+        }
+        if (navItem.width <= 0) {
+            navItem.width = FRLayeredNavigationControllerStandardWidth;
+        }
+
+        [self.layeredViewControllers addObject:newVC];
+        [addedLayers addObject:newVC];
+    }
+
+    [self invalidateLayoutCache];
+
+    const BOOL viewLoaded = [self isViewLoaded];
+    void (^replaceLayers)(void) = ^{
+        for (FRLayerController *vc in removedLayers) {
+            [self.viewBackend childViewController:vc willMoveToParentViewController:nil];
+            [self.viewBackend removeViewFromSuperview:vc.view];
+            [self.viewBackend removeChildViewControllerFromParentViewController:vc];
+        }
+
+        /*
+         * everything goes directly to its final, maximally compressed position. Without a view (state restoration)
+         * only the screen size is known: self.view would load the view and frame all the layers right here.
+         */
+        const CGFloat width = (viewLoaded ?
+                               [self containerWidth] :
+                               CGRectGetWidth([self getScreenBoundsForCurrentOrientation]));
+        const CGFloat height = viewLoaded ? CGRectGetHeight(self.view.bounds) : 0;
+        [self applyLayerLayout:[self layerLayoutForContainerSize:CGSizeMake(width, height)]];
+
+        [self.layeredViewControllers enumerateObjectsUsingBlock:^(FRLayerController *vc,
+                                                                  NSUInteger idx,
+                                                                  __unused BOOL *stop) {
+            FRLayeredNavigationItem *navItem = vc.layeredNavigationItem;
+            navItem.currentViewPosition = navItem.initialViewPosition;
+
+            if (idx >= keptLayers) {
+                [self.viewBackend addChildViewController:vc toParentViewController:self];
+            }
+
+            if (viewLoaded) {
+                CGRect f = CGRectMake(navItem.initialViewPosition.x,
+                                      navItem.initialViewPosition.y,
+                                      navItem.resolvedWidth,
+                                      height);
+                if (idx >= keptLayers) {
+                    vc.view.autoresizingMask = UIViewAutoresizingFlexibleHeight;
+                    [self.viewBackend setFrame:f forView:vc.view];
+                    [self.viewBackend addSubview:vc.view toView:self.view];
+                } else if (!CGRectEqualToRect(f, vc.view.frame)) {
+                    [self.viewBackend setFrame:f forView:vc.view];
+                }
+            }
+        }];
+
+        for (FRLayerController *vc in addedLayers) {
+            [self.viewBackend childViewController:vc didMoveToParentViewController:self];
+        }
+    };
+
+    if (animated && viewLoaded) {
+        [self.viewBackend transitionWithView:self.view
+                                    duration:0.3
+                                     options:UIViewAnimationOptionTransitionCrossDissolve
+                                  animations:replaceLayers
+                                  completion:^(__unused BOOL finished) {
+                                      [self scheduleThumbnailUpdate];
+                                  }];
+    } else {
+        replaceLayers();
+        [self scheduleThumbnailUpdate];
+    }
+}
+
 - (void)setUserInteractionEnabled:(BOOL)userInteractionEnabled
 {
     if (self.userInteractionEnabled != userInteractionEnabled) {
@@ -914,6 +1505,26 @@ typedef enum {
     return topLayerController.contentViewController;
 }
 
+- (NSArray *)predictedFramesForHorizontalVelocity:(CGFloat)velocity
+                          revealedViewControllers:(NSArray * __autoreleasing *)revealedViewControllers
+{
+    const SnappingPointsMethod method = [FRLayeredNavigationController snappingPointsMethodForVelocity:velocity];
+    NSMutableArray *currentPositions = [NSMutableArray arrayWithCapacity:[self.layeredViewControllers count]];
+
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        [currentPositions addObject:[NSValue valueWithCGPoint:vc.layeredNavigationItem.currentViewPosition]];
+    }
+
+    NSArray *frames = [self framesForPositions:[self snappingPositionsForMethod:method]];
+
+    if (revealedViewControllers != NULL) {
+        *revealedViewControllers = [self viewControllersRevealedFromFrames:[self framesForPositions:currentPositions]
+                                                                  toFrames:frames];
+    }
+
+    return frames;
+}
+
 - (void)compressViewControllers:(BOOL)animated;
 {
     void (^compact)(void) = ^{
@@ -924,20 +1535,150 @@ typedef enum {
                 CGRect f = layerController.view.frame;
                 f.origin.x = parentItem.currentViewPosition.x + parentItem.nextItemDistance;
                 navigationItem.currentViewPosition = f.origin;
-                layerController.view.frame = f;
+                [self.viewBackend setFrame:f forView:layerController.view];
             }
             parentItem = navigationItem;
         }
     };
 
     if (animated) {
-        [UIView animateWithDuration:0.5 animations:compact];
+        [self animateLayersWithDuration:0.5
+                                options:UIViewAnimationOptionCurveEaseInOut
+                             animations:compact
+                             completion:nil];
     }
     else {
         compact();
     }
 }
 
+- (void)setNeedsThumbnailUpdateForViewController:(UIViewController *)vc
+{
+    FRLayerController *layerController = [self layerControllerOf:vc];
+
+    [layerController setNeedsThumbnailUpdate];
+    if (layerController != nil) {
+        [self scheduleThumbnailUpdate];
+    }
+}
+
+- (void)excludeViewClassFromPanning:(Class)viewClass
+{
+    [self.panningExcludedViewClasses addObject:viewClass];
+}
+
+- (void)excludeViewFromPanning:(UIView *)view
+{
+    if (![self isViewExcludedFromPanning:view]) {
+        FRLayeredNavigationWeakReference *reference = [[FRLayeredNavigationWeakReference alloc] init];
+        reference.object = view;
+        [self.panningExcludedViews addObject:reference];
+    }
+}
+
+- (void)includeViewInPanning:(UIView *)view
+{
+    NSMutableArray *stillExcluded = [NSMutableArray arrayWithCapacity:[self.panningExcludedViews count]];
+
+    /* also drops the references to views which are gone */
+    for (FRLayeredNavigationWeakReference *reference in self.panningExcludedViews) {
+        id excludedView = reference.object;
+        if (excludedView != nil && excludedView != view) {
+            [stillExcluded addObject:reference];
+        }
+    }
+    self.panningExcludedViews = stillExcluded;
+}
+
+- (void)showOverviewAnimated:(BOOL)animated
+{
+    if (self.overviewVisible) {
+        return;
+    }
+
+    NSMutableArray *thumbnails = [NSMutableArray arrayWithCapacity:[self.layeredViewControllers count]];
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        [thumbnails addObject:vc.thumbnail != nil ? vc.thumbnail : [NSNull null]];
+    }
+
+    FRLayeredNavigationController __weak *weakSelf = self;
+    FRLayerOverviewView *overviewView =
+        [[FRLayerOverviewView alloc] initWithFrame:self.view.bounds
+                                        thumbnails:thumbnails
+                                  selectionHandler:^(NSUInteger layerIndex) {
+            FRLayeredNavigationController *strongSelf = weakSelf;
+            if (layerIndex >= [strongSelf.layeredViewControllers count]) {
+                return;
+            }
+            FRLayerController *selected = [strongSelf.layeredViewControllers objectAtIndex:layerIndex];
+
+            /* one cross-fade from the overview to the remaining layers instead of one animation per popped layer */
+            [strongSelf.viewBackend transitionWithView:strongSelf.view
+                                              duration:0.3
+                                               options:UIViewAnimationOptionTransitionCrossDissolve
+                                            animations:^{
+                                                [strongSelf hideOverviewAnimated:NO];
+                                                [strongSelf popToViewController:selected.contentViewController
+                                                                       animated:NO];
+                                            }
+                                            completion:nil];
+        }];
+    self.overviewView = overviewView;
+    [self.viewBackend addSubview:overviewView toView:self.view];
+
+    if (animated) {
+        [self.viewBackend setAlpha:0 forView:overviewView];
+        [self.viewBackend animateWithDuration:0.2
+                                        delay:0
+                                      options:UIViewAnimationOptionCurveEaseInOut
+                                   animations:^{
+                                       [self.viewBackend setAlpha:1 forView:overviewView];
+                                   }
+                                   completion:nil];
+    }
+
+    /* render the missing and outdated thumbnails, the overview gets updated as they arrive */
+    [self scheduleThumbnailUpdate];
+}
+
+- (void)hideOverviewAnimated:(BOOL)animated
+{
+    FRLayerOverviewView *overviewView = self.overviewView;
+
+    if (overviewView == nil) {
+        return;
+    }
+    self.overviewView = nil;
+
+    if (animated) {
+        [self.viewBackend animateWithDuration:0.2
+                                        delay:0
+                                      options:UIViewAnimationOptionCurveEaseInOut
+                                   animations:^{
+                                       [self.viewBackend setAlpha:0 forView:overviewView];
+                                   }
+                                   completion:^(__unused BOOL finished) {
+                                       [self.viewBackend removeViewFromSuperview:overviewView];
+                                   }];
+    } else {
+        [self.viewBackend removeViewFromSuperview:overviewView];
+    }
+}
+
 #pragma mark - properties
 
+- (void)setViewBackend:(id<FRViewBackend>)viewBackend
+{
+    self->_viewBackend = viewBackend;
+
+    for (FRLayerController *vc in self.layeredViewControllers) {
+        vc.viewBackend = viewBackend;
+    }
+}
+
+- (BOOL)overviewVisible
+{
+    return self.overviewView != nil;
+}
+
 @end
@@ -36,5 +36,6 @@
 @property (nonatomic, readwrite, weak) FRLayerController *layerController;
 @property (nonatomic, readwrite) CGPoint initialViewPosition;
 @property (nonatomic, readwrite) CGPoint currentViewPosition;
+@property (nonatomic, readwrite) CGFloat resolvedWidth;
 
 @end
@@ -32,6 +32,11 @@
 
 @class FRLayerController;
 
+/**
+ * The widthPriority of layers which always get their width, even if it doesn't fit on the screen.
+ */
+#define FRLayeredNavigationItemWidthPriorityRequired ((float)1000.0f)
+
 /**
  * FRLayeredNavigationItem is used to configure one view controller layer. It is very similar to UINavigationItem .
  *
@@ -43,8 +48,12 @@
     NSString *_title;
     UIView *_titleView;
     CGFloat _width;
+    CGFloat _resolvedWidth;
     CGFloat _snappingDistance;
     CGFloat _nextItemDistance;
+    CGFloat _minimumWidth;
+    CGFloat _maximumWidthLimit;
+    float _widthPriority;
     BOOL _hasChrome;
     BOOL _hasBorder;
     BOOL _displayShadow;
@@ -73,10 +82,36 @@
 @property (nonatomic, readwrite, strong) UIView *titleView;
 
 /**
- * The layer's width in points.
+ * The layer's (preferred) width in points, resolvedWidth is the width it actually gets.
  */
 @property (nonatomic, readwrite) CGFloat width;
 
+/**
+ * The layer's width in points as resolved by the layout. It differs from width for layers which get shrunk
+ * (widthPriority), limited (minimumWidth, maximumWidthLimit) or which have the maximum width.
+ */
+@property (nonatomic, readonly) CGFloat resolvedWidth;
+
+/**
+ * The minimal width of the layer in points, wins over all other width settings. Unset (negative) by default.
+ */
+@property (nonatomic, readwrite) CGFloat minimumWidth;
+
+/**
+ * The maximal width of the layer in points, also limits layers pushed with `maximumWidth:YES`. Unset (negative)
+ * by default.
+ */
+@property (nonatomic, readwrite) CGFloat maximumWidthLimit;
+
+/**
+ * If lower than FRLayeredNavigationItemWidthPriorityRequired (the default), the layer gets narrower than its width
+ * (but not narrower than minimumWidth) if there's not enough space on the screen to show it completely.
+ *
+ * The layers don't compete for space, so this is only a threshold: all the values below
+ * FRLayeredNavigationItemWidthPriorityRequired behave the same.
+ */
+@property (nonatomic, readwrite) float widthPriority;
+
 /**
  * The maximum distance (when the child layer is being pulled out) to the next layer in points.
  * If this value is unset, it defaults to the layer's width.
@@ -31,12 +31,14 @@
 #import "FRLayerController+Protected.h"
 #import "FRLayerController.h"
 #import "FRLayerChromeView.h"
+#import "FRLayeredNavigationController+Protected.h"
 
 @interface FRLayeredNavigationItem ()
 
 @property (nonatomic, readwrite, weak) FRLayerController *layerController;
 @property (nonatomic, readwrite) CGPoint initialViewPosition;
 @property (nonatomic, readwrite) CGPoint currentViewPosition;
+@property (nonatomic, readwrite) CGFloat resolvedWidth;
 
 @end
 
@@ -47,6 +49,9 @@
     if ((self = [super init])) {
         self->_width = -1;
         self->_nextItemDistance = -1;
+        self->_minimumWidth = -1;
+        self->_maximumWidthLimit = -1;
+        self->_widthPriority = FRLayeredNavigationItemWidthPriorityRequired;
         self->_snappingDistance = -1;
         self->_hasChrome = YES;
         self->_displayShadow = YES;
@@ -57,6 +62,60 @@
     return self;
 }
 
+- (void)setNeedsLayerLayout
+{
+    UIViewController *parent = self.layerController.parentViewController;
+
+    /* not yet pushed: the layout gets computed when pushing */
+    if ([parent isKindOfClass:[FRLayeredNavigationController class]]) {
+        [(FRLayeredNavigationController *)parent setNeedsLayerLayout];
+    }
+}
+
+- (void)setWidth:(CGFloat)width
+{
+    if (self->_width != width) {
+        self->_width = width;
+
+        /* the width of maximum width layers is an output of the layout, not an input */
+        if (!self.layerController.maximumWidth) {
+            [self setNeedsLayerLayout];
+        }
+    }
+}
+
+- (void)setMinimumWidth:(CGFloat)minimumWidth
+{
+    if (self->_minimumWidth != minimumWidth) {
+        self->_minimumWidth = minimumWidth;
+        [self setNeedsLayerLayout];
+    }
+}
+
+- (void)setMaximumWidthLimit:(CGFloat)maximumWidthLimit
+{
+    if (self->_maximumWidthLimit != maximumWidthLimit) {
+        self->_maximumWidthLimit = maximumWidthLimit;
+        [self setNeedsLayerLayout];
+    }
+}
+
+- (void)setWidthPriority:(float)widthPriority
+{
+    if (self->_widthPriority != widthPriority) {
+        self->_widthPriority = widthPriority;
+        [self setNeedsLayerLayout];
+    }
+}
+
+- (void)setNextItemDistance:(CGFloat)nextItemDistance
+{
+    if (self->_nextItemDistance != nextItemDistance) {
+        self->_nextItemDistance = nextItemDistance;
+        [self setNeedsLayerLayout];
+    }
+}
+
 - (void)setLeftBarButtonItem:(UIBarButtonItem *)leftBarButtonItem
 {
     FRLayerController *layerController = self.layerController;
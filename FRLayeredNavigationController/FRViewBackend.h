@@ -0,0 +1,73 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+
+/**
+ * The FRViewBackend protocol wraps every view hierarchy, geometry, animation and view controller containment
+ * operation FRLayeredNavigationController performs. The default implementation (FRUIKitViewBackend) forwards to
+ * UIKit; alternative implementations can record or count the operations to exercise the controller's logic without
+ * rendering anything.
+ */
+@protocol FRViewBackend <NSObject>
+
+- (void)setFrame:(CGRect)frame forView:(UIView *)view;
+- (CGRect)presentationFrameOfView:(UIView *)view;
+- (void)removeAnimationsOfView:(UIView *)view;
+- (void)setHidden:(BOOL)hidden forView:(UIView *)view;
+- (void)setAlpha:(CGFloat)alpha forView:(UIView *)view;
+- (void)addSubview:(UIView *)view toView:(UIView *)superview;
+- (void)insertSubview:(UIView *)view intoView:(UIView *)superview atIndex:(NSInteger)index;
+- (void)removeViewFromSuperview:(UIView *)view;
+
+- (void)addChildViewController:(UIViewController *)child toParentViewController:(UIViewController *)parent;
+- (void)childViewController:(UIViewController *)child didMoveToParentViewController:(UIViewController *)parent;
+- (void)childViewController:(UIViewController *)child willMoveToParentViewController:(UIViewController *)parent;
+- (void)removeChildViewControllerFromParentViewController:(UIViewController *)child;
+
+- (void)animateWithDuration:(NSTimeInterval)duration
+                      delay:(NSTimeInterval)delay
+                    options:(UIViewAnimationOptions)options
+                 animations:(void (^)(void))animations
+                 completion:(void (^)(BOOL finished))completion;
+
+- (void)transitionWithView:(UIView *)view
+                  duration:(NSTimeInterval)duration
+                   options:(UIViewAnimationOptions)options
+                animations:(void (^)(void))animations
+                completion:(void (^)(BOOL finished))completion;
+
+@end
+
+/**
+ * The default FRViewBackend which directly uses UIKit.
+ */
+@interface FRUIKitViewBackend : NSObject<FRViewBackend>
+
+@end
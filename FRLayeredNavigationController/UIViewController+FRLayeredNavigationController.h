@@ -52,4 +52,13 @@
  */
 @property (nonatomic, readonly, strong) FRLayeredNavigationItem *layeredNavigationItem;
 
+/**
+ * Both properties above are cached per view controller. The caches get invalidated whenever a layer is attached to
+ * or detached from a FRLayeredNavigationController and whenever the view controller itself moves to another parent.
+ *
+ * If you move a view controller which has child view controllers of its own from one layer to another without
+ * pushing or popping a layer, call this method afterwards so that its children pick up their new layer.
+ */
++ (void)invalidateLayeredNavigationLookupCaches;
+
 @end
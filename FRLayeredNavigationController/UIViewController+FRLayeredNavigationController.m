@@ -26,49 +26,106 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+/* Standard Library */
+#import <objc/runtime.h>
+
 /* Local Imports */
 #import "FRDLog.h"
 #import "UIViewController+FRLayeredNavigationController.h"
 #import "FRLayerController.h"
 
+/* bumped whenever a layer gets attached to or detached from its parent, invalidates all the lookup caches */
+static NSUInteger FRLayeredNavigationLookupGeneration = 0;
+static char FRLayeredNavigationLookupCacheKey;
+
+@interface FRLayeredNavigationLookupCache : NSObject
+
+@property (nonatomic, weak) FRLayerController *layerController;
+@property (nonatomic, weak) FRLayeredNavigationController *layeredNavigationController;
+@property (nonatomic, weak) UIViewController *parentViewController;
+@property (nonatomic) NSUInteger generation;
+
+@end
+
+@implementation FRLayeredNavigationLookupCache
+
+@end
+
 @implementation UIViewController (FRLayeredNavigationController)
 
-- (FRLayeredNavigationController *)layeredNavigationController
+#pragma mark - lookup cache
+
+- (FRLayeredNavigationLookupCache *)validLayeredNavigationLookupCache
 {
+    FRLayeredNavigationLookupCache *cache = objc_getAssociatedObject(self, &FRLayeredNavigationLookupCacheKey);
+    UIViewController *parent = self.parentViewController;
+
+    if (cache != nil &&
+        cache.generation == FRLayeredNavigationLookupGeneration &&
+        cache.parentViewController == parent) {
+        return cache;
+    }
+
+    if (cache == nil) {
+        cache = [[FRLayeredNavigationLookupCache alloc] init];
+        objc_setAssociatedObject(self, &FRLayeredNavigationLookupCacheKey, cache, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+
+    FRLayerController *layerController = nil;
+    FRLayeredNavigationController *layeredNavigationController = nil;
     UIViewController *here = self;
 
-    while (here != nil) {
-        if([here isKindOfClass:[FRLayeredNavigationController class]]) {
-            return (FRLayeredNavigationController *)here;
+    /* a miss costs what the lookups did before there was a cache: one walk up the hierarchy */
+    while (here != nil && (layerController == nil || layeredNavigationController == nil)) {
+        if (layerController == nil && [here isKindOfClass:[FRLayerController class]]) {
+            layerController = (FRLayerController *)here;
+        }
+        if (layeredNavigationController == nil && [here isKindOfClass:[FRLayeredNavigationController class]]) {
+            layeredNavigationController = (FRLayeredNavigationController *)here;
         }
 
         here = here.parentViewController;
     }
 
-    FRDLOG(@"WARNING: No instance of FRLayeredNavigationController in view controller hierachy!");
-    FRDLOG(@"HINT: If you used [UIWindow addSubview:], change it to [UIWindow setRootViewController:]");
+    cache.layerController = layerController;
+    cache.layeredNavigationController = layeredNavigationController;
+    cache.parentViewController = parent;
+    cache.generation = FRLayeredNavigationLookupGeneration;
 
-    return nil;
+    return cache;
 }
 
-- (FRLayeredNavigationItem *)layeredNavigationItem
++ (void)invalidateLayeredNavigationLookupCaches
 {
-    UIViewController *here = self;
+    FRLayeredNavigationLookupGeneration++;
+}
 
-    while (here != nil) {
-        if([here isKindOfClass:[FRLayerController class]]) {
-            return ((FRLayerController *)here).layeredNavigationItem;
-        }
+#pragma mark - public API
 
-        here = here.parentViewController;
-    }
+- (FRLayeredNavigationController *)layeredNavigationController
+{
+    FRLayeredNavigationController *layeredNavigationController =
+        [self validLayeredNavigationLookupCache].layeredNavigationController;
 
-    FRDLOG(@"WARNING: No instance of FRLayerController in view controller hierachy!");
-    FRDLOG(@"DEBUG: self: '%@', self.parentViewController: '%@'", self, self.parentViewController);
-    FRDLOG(@"HINT: The layeredNavigationItem property is nil until the view controller is shown on the screen.");
+    if (layeredNavigationController == nil) {
+        FRDLOG(@"WARNING: No instance of FRLayeredNavigationController in view controller hierachy!");
+        FRDLOG(@"HINT: If you used [UIWindow addSubview:], change it to [UIWindow setRootViewController:]");
+    }
 
-    return nil;
+    return layeredNavigationController;
 }
 
+- (FRLayeredNavigationItem *)layeredNavigationItem
+{
+    FRLayerController *layerController = [self validLayeredNavigationLookupCache].layerController;
+
+    if (layerController == nil) {
+        FRDLOG(@"WARNING: No instance of FRLayerController in view controller hierachy!");
+        FRDLOG(@"DEBUG: self: '%@', self.parentViewController: '%@'", self, self.parentViewController);
+        FRDLOG(@"HINT: The layeredNavigationItem property is nil until the view controller is shown on the screen.");
+    }
+
+    return layerController.layeredNavigationItem;
+}
 
 @end
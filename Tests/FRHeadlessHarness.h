@@ -0,0 +1,59 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+
+/* Local Imports */
+#import "FRLayeredNavigationController.h"
+#import "FRRecordingViewBackend.h"
+
+/**
+ * A FRLayeredNavigationController shown full screen in a headless 1024x768 (landscape iPad) window, performing all
+ * its view operations through a FRRecordingViewBackend.
+ */
+@interface FRHeadlessHarness : NSObject
+
+/**
+ * Creates the window and the layered navigation controller, shows it and lets it settle. The counters of the view
+ * backend start at zero.
+ *
+ * @param rootViewController The root view controller of the layered navigation controller.
+ */
+- (id)initWithRootViewController:(UIViewController *)rootViewController;
+
+/**
+ * Runs a few run loop turns, enough for all the pending layout passes, chrome updates and thumbnail updates.
+ */
+- (void)settle;
+
+@property (nonatomic, readonly, strong) UIWindow *window;
+@property (nonatomic, readonly, strong) FRLayeredNavigationController *layeredNavigationController;
+@property (nonatomic, readonly, strong) FRRecordingViewBackend *viewBackend;
+
+@end
@@ -0,0 +1,77 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Local Imports */
+#import "FRHeadlessHarness.h"
+#import "FRLayeredNavigationController+Protected.h"
+
+#define FRHeadlessHarnessSettleTurns 5
+
+@interface FRHeadlessHarness ()
+
+@property (nonatomic, readwrite, strong) UIWindow *window;
+@property (nonatomic, readwrite, strong) FRLayeredNavigationController *layeredNavigationController;
+@property (nonatomic, readwrite, strong) FRRecordingViewBackend *viewBackend;
+
+@end
+
+@implementation FRHeadlessHarness
+
+- (id)initWithRootViewController:(UIViewController *)rootViewController
+{
+    if ((self = [super init])) {
+        _window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 1024, 768)];
+        _viewBackend = [[FRRecordingViewBackend alloc] init];
+        _layeredNavigationController =
+            [[FRLayeredNavigationController alloc] initWithRootViewController:rootViewController];
+        _layeredNavigationController.viewBackend = _viewBackend;
+
+        _layeredNavigationController.view.frame = _window.bounds;
+        [_window addSubview:_layeredNavigationController.view];
+        [_layeredNavigationController viewDidAppear:NO];
+
+        [self settle];
+        [_viewBackend reset];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    /* the headless windows are never released */
+    [_layeredNavigationController.view removeFromSuperview];
+}
+
+- (void)settle
+{
+    for (NSUInteger i = 0; i < FRHeadlessHarnessSettleTurns; i++) {
+        HeadlessUIKitRunLoopTurn();
+    }
+}
+
+@end
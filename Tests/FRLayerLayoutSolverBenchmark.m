@@ -0,0 +1,198 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compares FRLayerLayoutSolver with the calculations push used to do before there was a solver: there, every push
+ * derived the new layer's initial position and width from its anchor only. The solver gives the same frames (checked
+ * first) but lays out the whole stack, which push now does after every push (the layout cache gets invalidated).
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+
+/* Local Imports */
+#import "FRLayerController.h"
+#import "FRLayerLayoutSolver.h"
+#import "FRLayeredNavigationItem.h"
+
+#define FRLayerLayoutSolverBenchmarkContainerWidth ((float)1024.0f)
+#define FRLayerLayoutSolverBenchmarkContainerHeight ((float)768.0f)
+#define FRLayerLayoutSolverBenchmarkLayoutsPerRun 100000
+
+static NSArray *FRLayerControllers(NSUInteger count, BOOL widthHints)
+{
+    NSMutableArray *layerControllers = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        /* every fifth layer takes all the remaining width */
+        FRLayerController *vc = [[FRLayerController alloc] initWithContentViewController:[[UIViewController alloc] init]
+                                                                            maximumWidth:i > 0 && i % 5 == 0];
+        FRLayeredNavigationItem *item = vc.layeredNavigationItem;
+
+        item.width = FRLayeredNavigationControllerStandardWidth;
+        if (i == 0) {
+            item.nextItemDistance = FRLayeredNavigationControllerStandardDistance;
+        }
+        if (widthHints) {
+            item.widthPriority = 500;
+            item.minimumWidth = 300;
+            item.maximumWidthLimit = 600;
+        }
+        [layerControllers addObject:vc];
+    }
+
+    return layerControllers;
+}
+
+/*
+ * what push computed for the layers one by one before the solver (without width hints), except that layers with the
+ * maximum width starting offscreen got non-positive widths there
+ */
+static NSArray *FRPushTimeFrames(NSArray *layerControllers)
+{
+    NSMutableArray *frames = [NSMutableArray arrayWithCapacity:[layerControllers count]];
+    const FRLayeredNavigationItem *parentItem = nil;
+    CGFloat initX = 0;
+
+    for (FRLayerController *vc in layerControllers) {
+        const FRLayeredNavigationItem *item = vc.layeredNavigationItem;
+
+        if (parentItem != nil) {
+            initX += ((parentItem.nextItemDistance >= 0) ?
+                      parentItem.nextItemDistance :
+                      FRLayeredNavigationControllerStandardDistance);
+        }
+
+        CGFloat width;
+        if (vc.maximumWidth) {
+            width = MAX(FRLayerLayoutSolverBenchmarkContainerWidth - initX,
+                        FRLayeredNavigationControllerStandardDistance);
+        } else {
+            width = item.width > 0 ? item.width : FRLayeredNavigationControllerStandardWidth;
+        }
+
+        [frames addObject:[NSValue valueWithCGRect:CGRectMake(initX,
+                                                              0,
+                                                              width,
+                                                              FRLayerLayoutSolverBenchmarkContainerHeight)]];
+        parentItem = item;
+    }
+
+    return frames;
+}
+
+static NSArray *FRSolvedFrames(NSArray *layerControllers)
+{
+    const CGSize containerSize = CGSizeMake(FRLayerLayoutSolverBenchmarkContainerWidth,
+                                            FRLayerLayoutSolverBenchmarkContainerHeight);
+
+    return [FRLayerLayoutSolver initialFramesOfLayerControllers:layerControllers containerSize:containerSize];
+}
+
+static void FRSolveAfterEveryPush(NSArray *layerControllers)
+{
+    for (NSUInteger i = 1; i <= [layerControllers count]; i++) {
+        FRSolvedFrames([layerControllers subarrayWithRange:NSMakeRange(0, i)]);
+    }
+}
+
+static void FRMeasure(NSString *name, NSUInteger layers, NSUInteger runs, void (^run)(void))
+{
+    const NSTimeInterval start = [NSDate timeIntervalSinceReferenceDate];
+
+    for (NSUInteger i = 0; i < runs; i++) {
+        @autoreleasepool {
+            run();
+        }
+    }
+
+    const NSTimeInterval perRun = ([NSDate timeIntervalSinceReferenceDate] - start) / runs;
+    printf("%4lu layers  %-48s %10.2f us\n", (unsigned long)layers, [name UTF8String], perRun * 1e6);
+}
+
+int main(__unused int argc, __unused char *argv[])
+{
+    int result = 0;
+
+    @autoreleasepool {
+        /* optional widths of layers starting offscreen (here in a split view sized container) never collapse */
+        NSArray *optionalWidthLayerControllers = FRLayerControllers(100, NO);
+        for (FRLayerController *vc in optionalWidthLayerControllers) {
+            vc.layeredNavigationItem.widthPriority = 500;
+        }
+        for (NSValue *frame in [FRLayerLayoutSolver initialFramesOfLayerControllers:optionalWidthLayerControllers
+                                                                      containerSize:CGSizeMake(320, 768)]) {
+            if (CGRectGetWidth([frame CGRectValue]) < FRLayeredNavigationControllerStandardDistance) {
+                printf("FAILED: a layer starting offscreen collapsed to %.1f points\n",
+                       CGRectGetWidth([frame CGRectValue]));
+                result = 1;
+                break;
+            }
+        }
+
+        for (NSNumber *layerCount in @[@10, @100]) {
+            const NSUInteger layers = [layerCount unsignedIntegerValue];
+            const NSUInteger runs = FRLayerLayoutSolverBenchmarkLayoutsPerRun / layers;
+            NSArray *layerControllers = FRLayerControllers(layers, NO);
+            NSArray *hintedLayerControllers = FRLayerControllers(layers, YES);
+
+            if (![FRSolvedFrames(layerControllers) isEqualToArray:FRPushTimeFrames(layerControllers)]) {
+                printf("FAILED: the solver and the push-time calculation disagree (%lu layers)\n",
+                       (unsigned long)layers);
+                result = 1;
+            }
+
+            /* the frames of a layer don't depend on the layers in front of it */
+            NSArray *before = FRSolvedFrames(layerControllers);
+            ((FRLayerController *)[layerControllers lastObject]).layeredNavigationItem.width = 123;
+            NSArray *after = FRSolvedFrames(layerControllers);
+            if (![[before subarrayWithRange:NSMakeRange(0, layers - 1)]
+                  isEqualToArray:[after subarrayWithRange:NSMakeRange(0, layers - 1)]]) {
+                printf("FAILED: changing the top layer moved other layers (%lu layers)\n", (unsigned long)layers);
+                result = 1;
+            }
+            ((FRLayerController *)[layerControllers lastObject]).layeredNavigationItem.width =
+                FRLayeredNavigationControllerStandardWidth;
+
+            FRMeasure(@"push-time calculation, all layers", layers, runs, ^{
+                FRPushTimeFrames(layerControllers);
+            });
+            FRMeasure(@"solver, whole stack once", layers, runs, ^{
+                FRSolvedFrames(layerControllers);
+            });
+            FRMeasure(@"solver, whole stack once (with width hints)", layers, runs, ^{
+                FRSolvedFrames(hintedLayerControllers);
+            });
+            FRMeasure(@"solver, after every push (building the stack)", layers, runs / layers + 1, ^{
+                FRSolveAfterEveryPush(layerControllers);
+            });
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+
+/* Local Imports */
+#import "FRViewBackend.h"
+
+/**
+ * A FRViewBackend which performs all the operations on the (headless) views right away and counts them. Animation
+ * blocks run immediately, so the views always have their final (model) frames. By default the animations complete
+ * immediately as well, see defersAnimationCompletions for animations which are still running.
+ */
+@interface FRRecordingViewBackend : NSObject<FRViewBackend>
+
+/**
+ * If `YES`, animations keep running until completeAnimations is called: their completion blocks are deferred and
+ * the views they move are shown (presentationFrameOfView:) at animationProgress between where they were and their
+ * final frame. removeAnimationsOfView: stops them there, their completions then get `finished == NO`.
+ */
+@property (nonatomic) BOOL defersAnimationCompletions;
+
+/**
+ * How far the running animations got, between 0 (just started) and 1 (done). Defaults to 0.5.
+ */
+@property (nonatomic) CGFloat animationProgress;
+
+/**
+ * Ends all the running animations and calls their completion blocks in the order they were started.
+ */
+- (void)completeAnimations;
+
+/**
+ * Sets all counters back to zero.
+ */
+- (void)reset;
+
+/**
+ * All the counters by name (NSString to NSNumber), see the properties below.
+ */
+- (NSDictionary *)counts;
+
+/** Frames set. */
+@property (nonatomic, readonly) NSUInteger frameWrites;
+
+/** Frames set which were already the frame of the view. */
+@property (nonatomic, readonly) NSUInteger redundantFrameWrites;
+
+/** Animations started with animateWithDuration:delay:options:animations:completion: . */
+@property (nonatomic, readonly) NSUInteger animations;
+
+/** Transitions started with transitionWithView:duration:options:animations:completion: . */
+@property (nonatomic, readonly) NSUInteger transitions;
+
+/** Views added, inserted or removed. */
+@property (nonatomic, readonly) NSUInteger hierarchyMutations;
+
+/** Views added to the superview they're already the front most subview of and views removed without superview. */
+@property (nonatomic, readonly) NSUInteger redundantHierarchyMutations;
+
+/** View controller containment calls (add/remove child, will/did move to parent). */
+@property (nonatomic, readonly) NSUInteger containmentCalls;
+
+/** Hidden and alpha values set. */
+@property (nonatomic, readonly) NSUInteger visibilityWrites;
+
+/** Hidden and alpha values set which the view already had. */
+@property (nonatomic, readonly) NSUInteger redundantVisibilityWrites;
+
+/** Animations of a view stopped (removeAnimationsOfView:). */
+@property (nonatomic, readonly) NSUInteger animationRemovals;
+
+@end
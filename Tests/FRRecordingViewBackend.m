@@ -0,0 +1,300 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Local Imports */
+#import "FRRecordingViewBackend.h"
+
+/* an animation which is still running (defersAnimationCompletions) */
+@interface FRRecordedAnimation : NSObject
+
+@property (nonatomic, copy) void (^completion)(BOOL finished);
+@property (nonatomic) BOOL finished;
+
+@end
+
+@implementation FRRecordedAnimation
+
+@end
+
+@interface FRRecordingViewBackend ()
+
+@property (nonatomic, readwrite) NSUInteger frameWrites;
+@property (nonatomic, readwrite) NSUInteger redundantFrameWrites;
+@property (nonatomic, readwrite) NSUInteger animations;
+@property (nonatomic, readwrite) NSUInteger transitions;
+@property (nonatomic, readwrite) NSUInteger hierarchyMutations;
+@property (nonatomic, readwrite) NSUInteger redundantHierarchyMutations;
+@property (nonatomic, readwrite) NSUInteger containmentCalls;
+@property (nonatomic, readwrite) NSUInteger visibilityWrites;
+@property (nonatomic, readwrite) NSUInteger redundantVisibilityWrites;
+@property (nonatomic, readwrite) NSUInteger animationRemovals;
+
+@property (nonatomic, strong) NSMutableArray *runningAnimations;
+/* the animation an animations block currently runs for */
+@property (nonatomic, strong) FRRecordedAnimation *currentAnimation;
+/* view pointer (NSValue) to the running animation moving it and its start frame */
+@property (nonatomic, strong) NSMutableDictionary *animationsOfViews;
+@property (nonatomic, strong) NSMutableDictionary *startFramesOfViews;
+
+@end
+
+@implementation FRRecordingViewBackend
+
+- (id)init
+{
+    if ((self = [super init])) {
+        _animationProgress = 0.5;
+        _runningAnimations = [[NSMutableArray alloc] init];
+        _animationsOfViews = [[NSMutableDictionary alloc] init];
+        _startFramesOfViews = [[NSMutableDictionary alloc] init];
+    }
+    return self;
+}
+
+- (void)completeAnimations
+{
+    NSArray *completedAnimations = [self.runningAnimations copy];
+
+    [self.runningAnimations removeAllObjects];
+    [self.animationsOfViews removeAllObjects];
+    [self.startFramesOfViews removeAllObjects];
+
+    for (FRRecordedAnimation *animation in completedAnimations) {
+        if (animation.completion != nil) {
+            animation.completion(animation.finished);
+        }
+    }
+}
+
+- (void)runAnimations:(void (^)(void))animations
+           completion:(void (^)(BOOL finished))completion
+          movingViews:(BOOL)movingViews
+{
+    if (!self.defersAnimationCompletions) {
+        if (animations != nil) {
+            animations();
+        }
+        if (completion != nil) {
+            completion(YES);
+        }
+        return;
+    }
+
+    FRRecordedAnimation *animation = [[FRRecordedAnimation alloc] init];
+    animation.completion = completion;
+    animation.finished = YES;
+    [self.runningAnimations addObject:animation];
+
+    /* transitions cross-fade, the frames set in them apply right away */
+    FRRecordedAnimation *outerAnimation = self.currentAnimation;
+    self.currentAnimation = movingViews ? animation : nil;
+    if (animations != nil) {
+        animations();
+    }
+    self.currentAnimation = outerAnimation;
+}
+
+- (void)reset
+{
+    self.frameWrites = 0;
+    self.redundantFrameWrites = 0;
+    self.animations = 0;
+    self.transitions = 0;
+    self.hierarchyMutations = 0;
+    self.redundantHierarchyMutations = 0;
+    self.containmentCalls = 0;
+    self.visibilityWrites = 0;
+    self.redundantVisibilityWrites = 0;
+    self.animationRemovals = 0;
+}
+
+- (NSDictionary *)counts
+{
+    return @{@"frameWrites": @(self.frameWrites),
+             @"redundantFrameWrites": @(self.redundantFrameWrites),
+             @"animations": @(self.animations),
+             @"transitions": @(self.transitions),
+             @"hierarchyMutations": @(self.hierarchyMutations),
+             @"redundantHierarchyMutations": @(self.redundantHierarchyMutations),
+             @"containmentCalls": @(self.containmentCalls),
+             @"visibilityWrites": @(self.visibilityWrites),
+             @"redundantVisibilityWrites": @(self.redundantVisibilityWrites),
+             @"animationRemovals": @(self.animationRemovals)};
+}
+
+#pragma mark - FRViewBackend
+
+- (void)setFrame:(CGRect)frame forView:(UIView *)view
+{
+    NSValue *key = [NSValue valueWithPointer:(__bridge const void *)view];
+
+    self.frameWrites++;
+    if (CGRectEqualToRect(frame, view.frame)) {
+        self.redundantFrameWrites++;
+    }
+
+    FRRecordedAnimation *previousAnimation = [self.animationsOfViews objectForKey:key];
+    if (previousAnimation != nil && previousAnimation != self.currentAnimation) {
+        /* taken over by the new animation or the new frame */
+        previousAnimation.finished = NO;
+    }
+
+    if (self.currentAnimation != nil) {
+        /* like UIViewAnimationOptionBeginFromCurrentState: starts where the view is shown right now */
+        [self.startFramesOfViews setObject:[NSValue valueWithCGRect:[self presentationFrameOfView:view]] forKey:key];
+        [self.animationsOfViews setObject:self.currentAnimation forKey:key];
+    } else {
+        /* jumps there, even if it was moving */
+        [self.startFramesOfViews removeObjectForKey:key];
+        [self.animationsOfViews removeObjectForKey:key];
+    }
+    view.frame = frame;
+}
+
+- (CGRect)presentationFrameOfView:(UIView *)view
+{
+    NSValue *startFrame = [self.startFramesOfViews objectForKey:[NSValue valueWithPointer:(__bridge const void *)view]];
+
+    if (startFrame == nil) {
+        /* not moving */
+        return view.frame;
+    }
+
+    const CGRect from = [startFrame CGRectValue];
+    const CGRect to = view.frame;
+    const CGFloat progress = self.animationProgress;
+    return CGRectMake(CGRectGetMinX(from) + (CGRectGetMinX(to) - CGRectGetMinX(from)) * progress,
+                      CGRectGetMinY(from) + (CGRectGetMinY(to) - CGRectGetMinY(from)) * progress,
+                      CGRectGetWidth(from) + (CGRectGetWidth(to) - CGRectGetWidth(from)) * progress,
+                      CGRectGetHeight(from) + (CGRectGetHeight(to) - CGRectGetHeight(from)) * progress);
+}
+
+- (void)removeAnimationsOfView:(UIView *)view
+{
+    NSValue *key = [NSValue valueWithPointer:(__bridge const void *)view];
+    FRRecordedAnimation *animation = [self.animationsOfViews objectForKey:key];
+
+    self.animationRemovals++;
+    if (animation != nil) {
+        /* like UIKit: the view jumps to its final frame unless the caller sets another one */
+        animation.finished = NO;
+        [self.startFramesOfViews removeObjectForKey:key];
+        [self.animationsOfViews removeObjectForKey:key];
+    }
+}
+
+- (void)setHidden:(BOOL)hidden forView:(UIView *)view
+{
+    self.visibilityWrites++;
+    if (view.hidden == hidden) {
+        self.redundantVisibilityWrites++;
+    }
+    view.hidden = hidden;
+}
+
+- (void)setAlpha:(CGFloat)alpha forView:(UIView *)view
+{
+    self.visibilityWrites++;
+    if (view.alpha == alpha) {
+        self.redundantVisibilityWrites++;
+    }
+    view.alpha = alpha;
+}
+
+- (void)addSubview:(UIView *)view toView:(UIView *)superview
+{
+    self.hierarchyMutations++;
+    if (view.superview == superview && [superview.subviews lastObject] == view) {
+        self.redundantHierarchyMutations++;
+    }
+    [superview addSubview:view];
+}
+
+- (void)insertSubview:(UIView *)view intoView:(UIView *)superview atIndex:(NSInteger)index
+{
+    self.hierarchyMutations++;
+    if (view.superview == superview && [superview.subviews indexOfObject:view] == (NSUInteger)index) {
+        self.redundantHierarchyMutations++;
+    }
+    [superview insertSubview:view atIndex:index];
+}
+
+- (void)removeViewFromSuperview:(UIView *)view
+{
+    self.hierarchyMutations++;
+    if (view.superview == nil) {
+        self.redundantHierarchyMutations++;
+    }
+    [view removeFromSuperview];
+}
+
+- (void)addChildViewController:(UIViewController *)child toParentViewController:(UIViewController *)parent
+{
+    self.containmentCalls++;
+    [parent addChildViewController:child];
+}
+
+- (void)childViewController:(UIViewController *)child didMoveToParentViewController:(UIViewController *)parent
+{
+    self.containmentCalls++;
+    [child didMoveToParentViewController:parent];
+}
+
+- (void)childViewController:(UIViewController *)child willMoveToParentViewController:(UIViewController *)parent
+{
+    self.containmentCalls++;
+    [child willMoveToParentViewController:parent];
+}
+
+- (void)removeChildViewControllerFromParentViewController:(UIViewController *)child
+{
+    self.containmentCalls++;
+    [child removeFromParentViewController];
+}
+
+- (void)animateWithDuration:(__unused NSTimeInterval)duration
+                      delay:(__unused NSTimeInterval)delay
+                    options:(__unused UIViewAnimationOptions)options
+                 animations:(void (^)(void))animations
+                 completion:(void (^)(BOOL finished))completion
+{
+    self.animations++;
+    [self runAnimations:animations completion:completion movingViews:YES];
+}
+
+- (void)transitionWithView:(__unused UIView *)view
+                  duration:(__unused NSTimeInterval)duration
+                   options:(__unused UIViewAnimationOptions)options
+                animations:(void (^)(void))animations
+                completion:(void (^)(BOOL finished))completion
+{
+    self.transitions++;
+    [self runAnimations:animations completion:completion movingViews:NO];
+}
+
+@end
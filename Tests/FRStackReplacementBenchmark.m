@@ -0,0 +1,141 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Builds 10 and 100 layer stacks the way deep-link and state restoration code used to (one unanimated push after the
+ * other) and with setViewControllers:configurations:animated: . Reports the time (including the layout pass which
+ * follows) and the view operations performed.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+
+/* Local Imports */
+#import "FRHeadlessHarness.h"
+#import "FRLayeredNavigationController.h"
+
+#define FRStackReplacementBenchmarkRunsPer100Layers 10
+
+typedef void (^FRStackBuilder)(FRLayeredNavigationController *controller, NSArray *viewControllers);
+
+static NSArray *FRContentViewControllers(NSUInteger count)
+{
+    NSMutableArray *viewControllers = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [viewControllers addObject:[[UIViewController alloc] init]];
+    }
+    return viewControllers;
+}
+
+static NSDictionary *FRMeasure(NSString *name, NSUInteger layers, NSUInteger runs, FRStackBuilder buildStack)
+{
+    NSTimeInterval total = 0;
+    NSDictionary *counts = nil;
+
+    for (NSUInteger i = 0; i < runs; i++) {
+        @autoreleasepool {
+            UIViewController *root = [[UIViewController alloc] init];
+            FRHeadlessHarness *harness = [[FRHeadlessHarness alloc] initWithRootViewController:root];
+            NSArray *viewControllers = [@[root] arrayByAddingObjectsFromArray:FRContentViewControllers(layers - 1)];
+
+            const NSTimeInterval start = [NSDate timeIntervalSinceReferenceDate];
+            buildStack(harness.layeredNavigationController, viewControllers);
+            [harness settle];
+            total += [NSDate timeIntervalSinceReferenceDate] - start;
+
+            counts = [harness.viewBackend counts];
+        }
+    }
+
+    printf("%4lu layers  %-38s %9.2f ms  frames %5lu (%lu redundant)  animations %4lu  transitions %lu  "
+           "hierarchy %5lu  containment %5lu\n",
+           (unsigned long)layers,
+           [name UTF8String],
+           total / runs * 1e3,
+           [[counts objectForKey:@"frameWrites"] unsignedLongValue],
+           [[counts objectForKey:@"redundantFrameWrites"] unsignedLongValue],
+           [[counts objectForKey:@"animations"] unsignedLongValue],
+           [[counts objectForKey:@"transitions"] unsignedLongValue],
+           [[counts objectForKey:@"hierarchyMutations"] unsignedLongValue],
+           [[counts objectForKey:@"containmentCalls"] unsignedLongValue]);
+
+    return counts;
+}
+
+int main(__unused int argc, __unused char *argv[])
+{
+    int result = 0;
+
+    @autoreleasepool {
+        FRStackBuilder push = ^(FRLayeredNavigationController *controller, NSArray *viewControllers) {
+            for (NSUInteger i = 1; i < [viewControllers count]; i++) {
+                [controller pushViewController:[viewControllers objectAtIndex:i]
+                                     inFrontOf:[viewControllers objectAtIndex:i - 1]
+                                  maximumWidth:NO
+                                      animated:NO];
+            }
+        };
+        FRStackBuilder set = ^(FRLayeredNavigationController *controller, NSArray *viewControllers) {
+            [controller setViewControllers:viewControllers configurations:nil animated:NO];
+        };
+        FRStackBuilder setAnimated = ^(FRLayeredNavigationController *controller, NSArray *viewControllers) {
+            [controller setViewControllers:viewControllers configurations:nil animated:YES];
+        };
+
+        for (NSNumber *layerCount in @[@10, @100]) {
+            const NSUInteger layers = [layerCount unsignedIntegerValue];
+            const NSUInteger runs = FRStackReplacementBenchmarkRunsPer100Layers * 100 / layers;
+
+            NSDictionary *pushed = FRMeasure(@"sequential pushes (unanimated)", layers, runs, push);
+            NSDictionary *replaced = FRMeasure(@"setViewControllers: (unanimated)", layers, runs, set);
+            NSDictionary *crossFaded = FRMeasure(@"setViewControllers: (cross-fade)", layers, runs, setAnimated);
+
+            /* the fast path sets every frame once and never animates the layers */
+            if ([[replaced objectForKey:@"frameWrites"] unsignedIntegerValue] >=
+                [[pushed objectForKey:@"frameWrites"] unsignedIntegerValue] ||
+                [[replaced objectForKey:@"redundantFrameWrites"] unsignedIntegerValue] > 0 ||
+                [[crossFaded objectForKey:@"animations"] unsignedIntegerValue] > 0 ||
+                [[crossFaded objectForKey:@"transitions"] unsignedIntegerValue] != 1) {
+                printf("FAILED: setViewControllers: isn't cheaper than pushing (%lu layers)\n", (unsigned long)layers);
+                result = 1;
+            }
+
+            /* each new layer: layer, border, chrome & content view framed and added once, 4 containment calls */
+            const NSUInteger perNewLayers = 4 * (layers - 1);
+            if ([[replaced objectForKey:@"frameWrites"] unsignedIntegerValue] > perNewLayers ||
+                [[replaced objectForKey:@"hierarchyMutations"] unsignedIntegerValue] > perNewLayers ||
+                [[replaced objectForKey:@"containmentCalls"] unsignedIntegerValue] > perNewLayers) {
+                printf("FAILED: setViewControllers: over its per layer budget (%lu layers)\n", (unsigned long)layers);
+                result = 1;
+            }
+        }
+    }
+
+    return result;
+}
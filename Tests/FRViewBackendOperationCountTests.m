@@ -0,0 +1,503 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Runs the push, pop, stack replacement, pan, snap, drop zone and overview operations of FRLayeredNavigationController
+ * on a headless UIKit and counts the view operations each of them performs (including the layout pass which follows).
+ * Fails if any count exceeds its budget: redundant operations are never budgeted, the other budgets are what the
+ * operation needs today. Lower a budget when an operation got cheaper, never raise it without a good reason.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+#import <UIKit/UIGestureRecognizerSubclass.h>
+
+/* Local Imports */
+#import "FRHeadlessHarness.h"
+#import "FRLayeredNavigationController.h"
+#import "FRLayeredNavigationController+Protected.h"
+#import "FRLayeredNavigationItem.h"
+#import "FRRecordingViewBackend.h"
+#import "UIViewController+FRLayeredNavigationController.h"
+
+@interface FRLayeredNavigationController (OperationCountTests)
+
+- (void)handleGesture:(UIPanGestureRecognizer *)gestureRecognizer;
+
+@end
+
+/* a one finger pan on the layered navigation controller's view, driven by the test */
+@interface FRScriptedPanGestureRecognizer : UIPanGestureRecognizer
+
+- (id)initWithLayeredNavigationController:(FRLayeredNavigationController *)layeredNavigationController;
+
+- (void)beginAtLocation:(CGPoint)location;
+- (void)moveBy:(CGFloat)xTranslation;
+- (void)endWithVelocity:(CGFloat)xVelocity;
+- (void)cancel;
+
+@end
+
+@interface FRScriptedPanGestureRecognizer ()
+
+@property (nonatomic, weak) FRLayeredNavigationController *layeredNavigationController;
+@property (nonatomic) CGPoint location;
+@property (nonatomic) CGPoint translation;
+@property (nonatomic) CGPoint velocity;
+
+@end
+
+@implementation FRScriptedPanGestureRecognizer
+
+- (id)initWithLayeredNavigationController:(FRLayeredNavigationController *)layeredNavigationController
+{
+    if ((self = [super initWithTarget:layeredNavigationController action:@selector(handleGesture:)])) {
+        _layeredNavigationController = layeredNavigationController;
+    }
+    return self;
+}
+
+- (UIView *)view
+{
+    return self.layeredNavigationController.view;
+}
+
+- (CGPoint)locationInView:(UIView *)view
+{
+    return [self.view convertPoint:self.location toView:view];
+}
+
+- (CGPoint)translationInView:(__unused UIView *)view
+{
+    return self.translation;
+}
+
+- (void)setTranslation:(CGPoint)translation inView:(__unused UIView *)view
+{
+    self.translation = translation;
+}
+
+- (CGPoint)velocityInView:(__unused UIView *)view
+{
+    return self.velocity;
+}
+
+- (void)beginAtLocation:(CGPoint)location
+{
+    self.location = location;
+    self.translation = CGPointZero;
+    self.velocity = CGPointZero;
+    self.state = UIGestureRecognizerStateBegan;
+}
+
+- (void)moveBy:(CGFloat)xTranslation
+{
+    /* the controller resets the translation after every step */
+    self.translation = CGPointMake(xTranslation, 0);
+    self.state = UIGestureRecognizerStateChanged;
+}
+
+- (void)endWithVelocity:(CGFloat)xVelocity
+{
+    self.velocity = CGPointMake(xVelocity, 0);
+    self.state = UIGestureRecognizerStateEnded;
+}
+
+- (void)cancel
+{
+    self.state = UIGestureRecognizerStateCancelled;
+}
+
+@end
+
+/* remembers what its view controller's lookups returned when it was taken off the screen (viewWillDisappear: time) */
+@interface FRLookupRecordingView : UIView
+
+@property (nonatomic, weak) UIViewController *viewController;
+@property (nonatomic, weak) FRLayeredNavigationController *layeredNavigationControllerWhenRemoved;
+@property (nonatomic, strong) FRLayeredNavigationItem *layeredNavigationItemWhenRemoved;
+
+@end
+
+@implementation FRLookupRecordingView
+
+- (void)removeFromSuperview
+{
+    UIViewController *viewController = self.viewController;
+
+    self.layeredNavigationControllerWhenRemoved = viewController.layeredNavigationController;
+    self.layeredNavigationItemWhenRemoved = viewController.layeredNavigationItem;
+    [super removeFromSuperview];
+}
+
+@end
+
+@interface FRLookupRecordingViewController : UIViewController
+
+@end
+
+@implementation FRLookupRecordingViewController
+
+- (void)loadView
+{
+    FRLookupRecordingView *view = [[FRLookupRecordingView alloc] initWithFrame:CGRectMake(0, 0, 400, 768)];
+    view.viewController = self;
+    self.view = view;
+}
+
+@end
+
+/* counts the pans which ended with the layers where they snapped to */
+@interface FRMoveCountingDelegate : NSObject<FRLayeredNavigationControllerDelegate>
+
+@property (nonatomic) NSUInteger didMoveCount;
+
+@end
+
+@implementation FRMoveCountingDelegate
+
+- (void)layeredNavigationController:(__unused FRLayeredNavigationController *)layeredController
+                  didMoveController:(__unused UIViewController *)controller
+{
+    self.didMoveCount++;
+}
+
+@end
+
+static BOOL FRTestsFailed = NO;
+
+static void FRExpect(BOOL condition, NSString *description)
+{
+    if (!condition) {
+        printf("    FAILED: %s\n", [description UTF8String]);
+        FRTestsFailed = YES;
+    }
+}
+
+static void FRPush(FRLayeredNavigationController *layeredNavigationController, BOOL animated)
+{
+    [layeredNavigationController pushViewController:[[UIViewController alloc] init]
+                                          inFrontOf:layeredNavigationController.topViewController
+                                       maximumWidth:NO
+                                           animated:animated];
+}
+
+static UIView *FRTopLayerView(FRLayeredNavigationController *layeredNavigationController)
+{
+    /* the content view's superview is the view of its FRLayerController */
+    return layeredNavigationController.topViewController.view.superview;
+}
+
+static UIView *FRDropNotificationView(FRLayeredNavigationController *layeredNavigationController)
+{
+    for (UIView *view in layeredNavigationController.view.subviews) {
+        if ([view isKindOfClass:[UILabel class]]) {
+            return view;
+        }
+    }
+    return nil;
+}
+
+static UIButton *FROverviewThumbnailButton(FRLayeredNavigationController *layeredNavigationController,
+                                           NSUInteger layerIndex)
+{
+    NSMutableArray *views = [NSMutableArray arrayWithArray:layeredNavigationController.view.subviews];
+    NSMutableArray *buttons = [NSMutableArray array];
+
+    /* breadth first, the thumbnail buttons are siblings in layer order */
+    while ([views count] > 0) {
+        UIView *view = [views objectAtIndex:0];
+        [views removeObjectAtIndex:0];
+        if ([view isKindOfClass:[UIButton class]]) {
+            [buttons addObject:view];
+        }
+        [views addObjectsFromArray:view.subviews];
+    }
+    return layerIndex < [buttons count] ? [buttons objectAtIndex:layerIndex] : nil;
+}
+
+static void FRCheckOperation(NSString *name,
+                             void (^setup)(FRLayeredNavigationController *layeredNavigationController),
+                             void (^operation)(FRLayeredNavigationController *layeredNavigationController),
+                             NSDictionary *budget)
+{
+    @autoreleasepool {
+        FRHeadlessHarness *harness = [[FRHeadlessHarness alloc] initWithRootViewController:
+                                      [[UIViewController alloc] init]];
+        FRLayeredNavigationController *layeredNavigationController = harness.layeredNavigationController;
+
+        if (setup != nil) {
+            setup(layeredNavigationController);
+            [harness settle];
+        }
+        [harness.viewBackend reset];
+
+        printf("%s\n", [name UTF8String]);
+        operation(layeredNavigationController);
+        [harness settle];
+
+        const NSDictionary *counts = [harness.viewBackend counts];
+        for (NSString *counter in [[counts allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+            const NSUInteger count = [[counts objectForKey:counter] unsignedIntegerValue];
+            /* not budgeted: none allowed */
+            const NSUInteger allowed = [[budget objectForKey:counter] unsignedIntegerValue];
+
+            printf("    %-28s %4lu (budget %lu)\n", [counter UTF8String], (unsigned long)count, (unsigned long)allowed);
+            FRExpect(count <= allowed, [NSString stringWithFormat:@"%@: %@ over budget", name, counter]);
+        }
+    }
+}
+
+int main(__unused int argc, __unused char *argv[])
+{
+    @autoreleasepool {
+        /* offscreen, then onscreen frame of the layer; border, chrome & content frames in the layout pass */
+        FRCheckOperation(@"push", nil, ^(FRLayeredNavigationController *controller) {
+            FRPush(controller, NO);
+            FRExpect([controller.viewControllers count] == 2, @"push: layer not pushed");
+        }, @{@"frameWrites": @5, @"hierarchyMutations": @4, @"containmentCalls": @4});
+
+        FRCheckOperation(@"push (animated)", nil, ^(FRLayeredNavigationController *controller) {
+            FRPush(controller, YES);
+        }, @{@"frameWrites": @5, @"animations": @1, @"hierarchyMutations": @4, @"containmentCalls": @4});
+
+        FRCheckOperation(@"pop (animated)", ^(FRLayeredNavigationController *controller) {
+            [controller pushViewController:[[FRLookupRecordingViewController alloc] init]
+                                 inFrontOf:controller.topViewController
+                              maximumWidth:NO
+                                  animated:NO];
+        }, ^(FRLayeredNavigationController *controller) {
+            FRLookupRecordingView *view = (FRLookupRecordingView *)controller.topViewController.view;
+            [controller popViewControllerAnimated:YES];
+            FRExpect([controller.viewControllers count] == 1, @"pop: layer not popped");
+            FRExpect(view.layeredNavigationControllerWhenRemoved == controller,
+                     @"pop: layeredNavigationController lost before the content view was removed");
+            FRExpect(view.layeredNavigationItemWhenRemoved != nil,
+                     @"pop: layeredNavigationItem lost before the content view was removed");
+        }, @{@"frameWrites": @1, @"animations": @1, @"hierarchyMutations": @2, @"containmentCalls": @4});
+
+        /* every popped layer: one frame, one animation, its view & content view removed, 4 containment calls */
+        FRCheckOperation(@"pop to (animated, 2 layers)", ^(FRLayeredNavigationController *controller) {
+            FRPush(controller, NO);
+            FRPush(controller, NO);
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            UIViewController *target = [controller.viewControllers objectAtIndex:1];
+            [controller popToViewController:target animated:YES];
+            FRExpect(controller.topViewController == target, @"pop to: wrong top view controller");
+        }, @{@"frameWrites": @2, @"animations": @2, @"hierarchyMutations": @4, @"containmentCalls": @8});
+
+        /* every new layer: its final frame plus border, chrome & content; no offscreen frames, no animations */
+        void (^replaceStack)(FRLayeredNavigationController *, BOOL) =
+            ^(FRLayeredNavigationController *controller, BOOL animated) {
+                UIViewController *root = [controller.viewControllers objectAtIndex:0];
+                [controller setViewControllers:@[root,
+                                                 [[UIViewController alloc] init],
+                                                 [[UIViewController alloc] init],
+                                                 [[UIViewController alloc] init]]
+                                configurations:nil
+                                      animated:animated];
+                FRExpect([controller.viewControllers count] == 4, @"set: wrong number of layers");
+                FRExpect(FRTopLayerView(controller).superview == controller.view, @"set: top layer not shown");
+            };
+        FRCheckOperation(@"set view controllers (3 new layers)", nil, ^(FRLayeredNavigationController *controller) {
+            replaceStack(controller, NO);
+        }, @{@"frameWrites": @12, @"hierarchyMutations": @12, @"containmentCalls": @12});
+
+        FRCheckOperation(@"set view controllers (animated)", nil, ^(FRLayeredNavigationController *controller) {
+            replaceStack(controller, YES);
+        }, @{@"frameWrites": @12, @"transitions": @1, @"hierarchyMutations": @12, @"containmentCalls": @12});
+
+        /* state restoration: replacing the stack before there's a view mustn't load it, nothing gets framed twice */
+        @autoreleasepool {
+            printf("set view controllers (view not loaded)\n");
+            FRRecordingViewBackend *backend = [[FRRecordingViewBackend alloc] init];
+            FRLayeredNavigationController *controller =
+                [[FRLayeredNavigationController alloc] initWithRootViewController:[[UIViewController alloc] init]];
+            controller.viewBackend = backend;
+
+            [controller setViewControllers:@[[controller.viewControllers objectAtIndex:0],
+                                             [[UIViewController alloc] init],
+                                             [[UIViewController alloc] init],
+                                             [[UIViewController alloc] init]]
+                            configurations:nil
+                                  animated:YES];
+            FRExpect(![controller isViewLoaded], @"set (view not loaded): view loaded");
+            FRExpect(backend.frameWrites == 0, @"set (view not loaded): layers framed before the view exists");
+            FRExpect(backend.transitions == 0, @"set (view not loaded): transition without a view");
+
+            [backend reset];
+            FRExpect(controller.view != nil, @"set (view not loaded): no view");
+            FRExpect(backend.frameWrites == 4 && backend.redundantFrameWrites == 0,
+                     @"set (view not loaded): layers not framed exactly once when the view loads");
+        }
+
+        /* only the moving layer gets new frames: one per pan step and one to snap back */
+        FRCheckOperation(@"pan and snap", ^(FRLayeredNavigationController *controller) {
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            FRScriptedPanGestureRecognizer *pan =
+                [[FRScriptedPanGestureRecognizer alloc] initWithLayeredNavigationController:controller];
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            [pan moveBy:-100];
+            [pan endWithVelocity:0];
+            FRExpect(CGRectGetMinX(FRTopLayerView(controller).frame) == 400,
+                     @"pan and snap: layer didn't snap back");
+        }, @{@"frameWrites": @2, @"animations": @1});
+
+        /* thumbnails only get rendered for the overview; selecting one pops all the layers in one cross-fade */
+        __block NSUInteger rendersBeforePushing = 0;
+        FRCheckOperation(@"overview selection (3 layers popped)", ^(FRLayeredNavigationController *controller) {
+            rendersBeforePushing = HeadlessUIKitLayerRenderCount();
+            FRPush(controller, NO);
+            FRPush(controller, NO);
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            FRExpect(HeadlessUIKitLayerRenderCount() == rendersBeforePushing,
+                     @"overview: thumbnails rendered without an overview");
+            [controller showOverviewAnimated:NO];
+            for (NSUInteger i = 0; i < 5; i++) {
+                HeadlessUIKitRunLoopTurn();
+            }
+            FRExpect(HeadlessUIKitLayerRenderCount() == rendersBeforePushing + 4,
+                     @"overview: not every layer's thumbnail rendered once");
+
+            [FROverviewThumbnailButton(controller, 0) sendActionsForControlEvents:UIControlEventTouchUpInside];
+            FRExpect([controller.viewControllers count] == 1, @"overview: layers not popped");
+            FRExpect(!controller.overviewVisible, @"overview: still visible");
+        }, @{@"transitions": @1, @"hierarchyMutations": @8, @"containmentCalls": @12});
+
+        /*
+         * a pan grabbing a layer which is still moving (interruptible animations): the layer stops where it's shown,
+         * the pan moves it on from there and the interrupted animation's completion doesn't end the pan
+         */
+        FRCheckOperation(@"pan during an animated push", nil, ^(FRLayeredNavigationController *controller) {
+            FRRecordingViewBackend *backend = (FRRecordingViewBackend *)controller.viewBackend;
+            backend.defersAnimationCompletions = YES;
+
+            FRPush(controller, YES);
+            UIView *layerView = FRTopLayerView(controller);
+            const CGRect shown = [backend presentationFrameOfView:layerView];
+            FRExpect(!CGRectEqualToRect(shown, layerView.frame), @"pan during push: push not running");
+
+            FRScriptedPanGestureRecognizer *pan =
+                [[FRScriptedPanGestureRecognizer alloc] initWithLayeredNavigationController:controller];
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            FRExpect(CGRectEqualToRect(layerView.frame, shown), @"pan during push: layer didn't stop where shown");
+            FRExpect(controller.topViewController.layeredNavigationItem.currentViewPosition.x == CGRectGetMinX(shown),
+                     @"pan during push: layer position not taken from the screen");
+            [pan moveBy:-10];
+            FRExpect(CGRectGetMinX(layerView.frame) == CGRectGetMinX(shown) - 10,
+                     @"pan during push: layer jumped");
+
+            [backend completeAnimations];
+            FRExpect(controller.topViewController.parentViewController.parentViewController == controller,
+                     @"pan during push: layer not attached");
+            [pan endWithVelocity:0];
+            [backend completeAnimations];
+            FRExpect(CGRectGetMinX(layerView.frame) == 400, @"pan during push: layer didn't snap back");
+        }, @{@"frameWrites": @8,
+             @"animations": @2,
+             @"hierarchyMutations": @4,
+             @"containmentCalls": @4,
+             @"animationRemovals": @2});
+
+        FRCheckOperation(@"pan during a snap", ^(FRLayeredNavigationController *controller) {
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            FRRecordingViewBackend *backend = (FRRecordingViewBackend *)controller.viewBackend;
+            FRMoveCountingDelegate *delegate = [[FRMoveCountingDelegate alloc] init];
+            backend.defersAnimationCompletions = YES;
+            controller.delegate = delegate;
+
+            UIView *layerView = FRTopLayerView(controller);
+            FRScriptedPanGestureRecognizer *pan =
+                [[FRScriptedPanGestureRecognizer alloc] initWithLayeredNavigationController:controller];
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            [pan moveBy:-100];
+            [pan endWithVelocity:0];
+            FRExpect(CGRectGetMinX([backend presentationFrameOfView:layerView]) == 350,
+                     @"pan during snap: snap not running");
+
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            FRExpect(CGRectGetMinX(layerView.frame) == 350, @"pan during snap: layer didn't stop where shown");
+            [backend completeAnimations];
+            FRExpect(delegate.didMoveCount == 0, @"pan during snap: interrupted snap ended the new pan");
+            [pan moveBy:-10];
+            FRExpect(CGRectGetMinX(layerView.frame) == 340, @"pan during snap: layer jumped");
+
+            [pan endWithVelocity:0];
+            [backend completeAnimations];
+            FRExpect(CGRectGetMinX(layerView.frame) == 400, @"pan during snap: layer didn't snap back");
+            FRExpect(delegate.didMoveCount == 1, @"pan during snap: pan didn't end");
+            controller.delegate = nil;
+        }, @{@"frameWrites": @5, @"animations": @2, @"animationRemovals": @2});
+
+        /* in, out (hysteresis), in again and dropped: the indicator is created once and then only shown/hidden */
+        FRCheckOperation(@"drop zone", ^(FRLayeredNavigationController *controller) {
+            controller.dropLayersWhenPulledRight = YES;
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            FRScriptedPanGestureRecognizer *pan =
+                [[FRScriptedPanGestureRecognizer alloc] initWithLayeredNavigationController:controller];
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            [pan moveBy:350];
+            FRExpect(!FRDropNotificationView(controller).hidden, @"drop zone: indicator not shown");
+            [pan moveBy:-40];
+            FRExpect(!FRDropNotificationView(controller).hidden, @"drop zone: no hysteresis");
+            [pan moveBy:-40];
+            FRExpect(FRDropNotificationView(controller).hidden, @"drop zone: indicator not hidden");
+            [pan moveBy:40];
+            [pan endWithVelocity:0];
+            FRExpect([controller.viewControllers count] == 1, @"drop zone: layers not dropped");
+            FRExpect(FRDropNotificationView(controller).hidden, @"drop zone: indicator left shown");
+        }, @{@"frameWrites": @6,
+             @"animations": @2,
+             @"hierarchyMutations": @3,
+             @"containmentCalls": @4,
+             @"visibilityWrites": @5});
+
+        FRCheckOperation(@"cancelled pan in the drop zone", ^(FRLayeredNavigationController *controller) {
+            controller.dropLayersWhenPulledRight = YES;
+            FRPush(controller, NO);
+        }, ^(FRLayeredNavigationController *controller) {
+            FRScriptedPanGestureRecognizer *pan =
+                [[FRScriptedPanGestureRecognizer alloc] initWithLayeredNavigationController:controller];
+            [pan beginAtLocation:CGPointMake(500, 300)];
+            [pan moveBy:350];
+            [pan cancel];
+            FRExpect([controller.viewControllers count] == 2, @"cancelled pan: layers dropped");
+            FRExpect(FRDropNotificationView(controller).hidden, @"cancelled pan: indicator shown");
+            FRExpect(CGRectGetMinX(FRTopLayerView(controller).frame) == 400,
+                     @"cancelled pan: layer didn't snap back");
+        }, @{@"frameWrites": @3, @"animations": @1, @"hierarchyMutations": @1, @"visibilityWrites": @3});
+    }
+
+    printf("%s\n", FRTestsFailed ? "FAILED" : "OK");
+    return FRTestsFailed ? 1 : 0;
+}
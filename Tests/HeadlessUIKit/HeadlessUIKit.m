@@ -0,0 +1,1237 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Library */
+#import <UIKit/UIKit.h>
+#import <UIKit/UIGestureRecognizerSubclass.h>
+
+#pragma mark - CoreGraphics
+
+const CGPoint CGPointZero = { 0, 0 };
+const CGRect CGRectZero = { { 0, 0 }, { 0, 0 } };
+const CGRect CGRectNull = { { CGFLOAT_MAX, CGFLOAT_MAX }, { 0, 0 } };
+
+/* the opaque CoreGraphics types only need to be distinct non-NULL pointers */
+static char HeadlessColorSpace;
+static char HeadlessGradient;
+static char HeadlessContext;
+static NSUInteger HeadlessLayerRenderCount = 0;
+
+CGPoint CGPointMake(CGFloat x, CGFloat y)
+{
+    CGPoint point = { x, y };
+    return point;
+}
+
+CGSize CGSizeMake(CGFloat width, CGFloat height)
+{
+    CGSize size = { width, height };
+    return size;
+}
+
+CGRect CGRectMake(CGFloat x, CGFloat y, CGFloat width, CGFloat height)
+{
+    CGRect rect = { { x, y }, { width, height } };
+    return rect;
+}
+
+CGFloat CGRectGetMinX(CGRect rect)
+{
+    return rect.origin.x;
+}
+
+CGFloat CGRectGetMidX(CGRect rect)
+{
+    return rect.origin.x + rect.size.width / 2;
+}
+
+CGFloat CGRectGetMaxX(CGRect rect)
+{
+    return rect.origin.x + rect.size.width;
+}
+
+CGFloat CGRectGetMinY(CGRect rect)
+{
+    return rect.origin.y;
+}
+
+CGFloat CGRectGetMidY(CGRect rect)
+{
+    return rect.origin.y + rect.size.height / 2;
+}
+
+CGFloat CGRectGetMaxY(CGRect rect)
+{
+    return rect.origin.y + rect.size.height;
+}
+
+CGFloat CGRectGetWidth(CGRect rect)
+{
+    return rect.size.width;
+}
+
+CGFloat CGRectGetHeight(CGRect rect)
+{
+    return rect.size.height;
+}
+
+bool CGPointEqualToPoint(CGPoint point1, CGPoint point2)
+{
+    return point1.x == point2.x && point1.y == point2.y;
+}
+
+bool CGSizeEqualToSize(CGSize size1, CGSize size2)
+{
+    return size1.width == size2.width && size1.height == size2.height;
+}
+
+bool CGRectEqualToRect(CGRect rect1, CGRect rect2)
+{
+    return CGPointEqualToPoint(rect1.origin, rect2.origin) && CGSizeEqualToSize(rect1.size, rect2.size);
+}
+
+bool CGRectIsNull(CGRect rect)
+{
+    return rect.origin.x == CGFLOAT_MAX || rect.origin.y == CGFLOAT_MAX;
+}
+
+bool CGRectIsEmpty(CGRect rect)
+{
+    return CGRectIsNull(rect) || rect.size.width <= 0 || rect.size.height <= 0;
+}
+
+bool CGRectIntersectsRect(CGRect rect1, CGRect rect2)
+{
+    if (CGRectIsEmpty(rect1) || CGRectIsEmpty(rect2)) {
+        return false;
+    }
+
+    return (CGRectGetMinX(rect1) < CGRectGetMaxX(rect2) && CGRectGetMinX(rect2) < CGRectGetMaxX(rect1) &&
+            CGRectGetMinY(rect1) < CGRectGetMaxY(rect2) && CGRectGetMinY(rect2) < CGRectGetMaxY(rect1));
+}
+
+bool CGRectContainsPoint(CGRect rect, CGPoint point)
+{
+    return (point.x >= CGRectGetMinX(rect) && point.x < CGRectGetMaxX(rect) &&
+            point.y >= CGRectGetMinY(rect) && point.y < CGRectGetMaxY(rect));
+}
+
+CGColorSpaceRef CGColorSpaceCreateDeviceRGB(void)
+{
+    return (CGColorSpaceRef)&HeadlessColorSpace;
+}
+
+void CGColorSpaceRelease(__unused CGColorSpaceRef space)
+{
+}
+
+CGGradientRef CGGradientCreateWithColorComponents(__unused CGColorSpaceRef space,
+                                                  __unused const CGFloat components[],
+                                                  __unused const CGFloat locations[],
+                                                  __unused size_t count)
+{
+    return (CGGradientRef)&HeadlessGradient;
+}
+
+void CGGradientRelease(__unused CGGradientRef gradient)
+{
+}
+
+void CGContextDrawLinearGradient(__unused CGContextRef context,
+                                 __unused CGGradientRef gradient,
+                                 __unused CGPoint startPoint,
+                                 __unused CGPoint endPoint,
+                                 __unused CGGradientDrawingOptions options)
+{
+}
+
+void CGContextSetFillColorWithColor(__unused CGContextRef context, __unused CGColorRef color)
+{
+}
+
+void CGContextFillRect(__unused CGContextRef context, __unused CGRect rect)
+{
+}
+
+NSString *NSStringFromCGPoint(CGPoint point)
+{
+    return [NSString stringWithFormat:@"{%g, %g}", point.x, point.y];
+}
+
+NSString *NSStringFromCGSize(CGSize size)
+{
+    return [NSString stringWithFormat:@"{%g, %g}", size.width, size.height];
+}
+
+NSString *NSStringFromCGRect(CGRect rect)
+{
+    return [NSString stringWithFormat:@"{%@, %@}", NSStringFromCGPoint(rect.origin), NSStringFromCGSize(rect.size)];
+}
+
+@implementation NSValue (HeadlessUIKitGeometry)
+
++ (NSValue *)valueWithCGPoint:(CGPoint)point
+{
+    return [NSValue valueWithBytes:&point objCType:@encode(CGPoint)];
+}
+
++ (NSValue *)valueWithCGSize:(CGSize)size
+{
+    return [NSValue valueWithBytes:&size objCType:@encode(CGSize)];
+}
+
++ (NSValue *)valueWithCGRect:(CGRect)rect
+{
+    return [NSValue valueWithBytes:&rect objCType:@encode(CGRect)];
+}
+
+- (CGPoint)CGPointValue
+{
+    CGPoint point = CGPointZero;
+    [self getValue:&point];
+    return point;
+}
+
+- (CGSize)CGSizeValue
+{
+    CGSize size = CGSizeMake(0, 0);
+    [self getValue:&size];
+    return size;
+}
+
+- (CGRect)CGRectValue
+{
+    CGRect rect = CGRectZero;
+    [self getValue:&rect];
+    return rect;
+}
+
+@end
+
+#pragma mark - CoreFoundation run loop observers
+
+const CFAllocatorRef kCFAllocatorDefault = NULL;
+const CFStringRef kCFRunLoopCommonModes = NULL;
+
+static char HeadlessMainRunLoop;
+
+@interface HeadlessRunLoopObserver : NSObject
+
+@property (nonatomic, copy) void (^block)(CFRunLoopObserverRef observer, CFRunLoopActivity activity);
+@property (nonatomic) CFOptionFlags activities;
+
+@end
+
+@implementation HeadlessRunLoopObserver
+
+@end
+
+static NSMutableArray *HeadlessRunLoopObservers(void)
+{
+    static NSMutableArray *observers = nil;
+
+    if (observers == nil) {
+        observers = [[NSMutableArray alloc] init];
+    }
+    return observers;
+}
+
+CFRunLoopRef CFRunLoopGetMain(void)
+{
+    return (CFRunLoopRef)&HeadlessMainRunLoop;
+}
+
+CFRunLoopObserverRef CFRunLoopObserverCreateWithHandler(__unused CFAllocatorRef allocator,
+                                                        CFOptionFlags activities,
+                                                        __unused Boolean repeats,
+                                                        __unused CFIndex order,
+                                                        void (^block)(CFRunLoopObserverRef observer,
+                                                                      CFRunLoopActivity activity))
+{
+    HeadlessRunLoopObserver *observer = [[HeadlessRunLoopObserver alloc] init];
+    observer.block = block;
+    observer.activities = activities;
+
+    return (__bridge_retained CFRunLoopObserverRef)observer;
+}
+
+void CFRunLoopAddObserver(__unused CFRunLoopRef runLoop, CFRunLoopObserverRef observer, __unused CFStringRef mode)
+{
+    [HeadlessRunLoopObservers() addObject:(__bridge HeadlessRunLoopObserver *)observer];
+}
+
+void CFRunLoopObserverInvalidate(CFRunLoopObserverRef observer)
+{
+    [HeadlessRunLoopObservers() removeObjectIdenticalTo:(__bridge HeadlessRunLoopObserver *)observer];
+}
+
+void CFRelease(CFTypeRef object)
+{
+    /* only used for the run loop observers, which are objects here */
+    id released = (__bridge_transfer id)(void *)object;
+    (void)released;
+}
+
+#pragma mark - QuartzCore
+
+@implementation CALayer
+
+- (id)presentationLayer
+{
+    return nil;
+}
+
+- (void)removeAllAnimations
+{
+}
+
+- (void)renderInContext:(__unused CGContextRef)context
+{
+    HeadlessLayerRenderCount++;
+}
+
+@end
+
+#pragma mark - UIKit constants
+
+NSString *const UITextAttributeFont = @"UITextAttributeFont";
+NSString *const UITextAttributeTextColor = @"UITextAttributeTextColor";
+NSString *const UITextAttributeTextShadowColor = @"UITextAttributeTextShadowColor";
+NSString *const UITextAttributeTextShadowOffset = @"UITextAttributeTextShadowOffset";
+
+#pragma mark - UIKit drawing
+
+@implementation UIColor
+
++ (UIColor *)colorWithWhite:(__unused CGFloat)white alpha:(__unused CGFloat)alpha
+{
+    return [[self alloc] init];
+}
+
++ (UIColor *)colorWithRed:(__unused CGFloat)red
+                    green:(__unused CGFloat)green
+                     blue:(__unused CGFloat)blue
+                    alpha:(__unused CGFloat)alpha
+{
+    return [[self alloc] init];
+}
+
++ (UIColor *)clearColor
+{
+    return [[self alloc] init];
+}
+
++ (UIColor *)blackColor
+{
+    return [[self alloc] init];
+}
+
++ (UIColor *)whiteColor
+{
+    return [[self alloc] init];
+}
+
++ (UIColor *)redColor
+{
+    return [[self alloc] init];
+}
+
+- (CGColorRef)CGColor
+{
+    return NULL;
+}
+
+@end
+
+@implementation UIFont
+
++ (UIFont *)boldSystemFontOfSize:(__unused CGFloat)fontSize
+{
+    return [[self alloc] init];
+}
+
+@end
+
+@implementation UIImage
+
+- (id)initWithSize:(CGSize)size
+{
+    if ((self = [super init])) {
+        _size = size;
+    }
+    return self;
+}
+
+@end
+
+static NSMutableArray *HeadlessImageContextSizes(void)
+{
+    static NSMutableArray *sizes = nil;
+
+    if (sizes == nil) {
+        sizes = [[NSMutableArray alloc] init];
+    }
+    return sizes;
+}
+
+void UIGraphicsBeginImageContext(CGSize size)
+{
+    UIGraphicsBeginImageContextWithOptions(size, NO, 1);
+}
+
+void UIGraphicsBeginImageContextWithOptions(CGSize size, __unused BOOL opaque, __unused CGFloat scale)
+{
+    [HeadlessImageContextSizes() addObject:[NSValue valueWithCGSize:size]];
+}
+
+CGContextRef UIGraphicsGetCurrentContext(void)
+{
+    return [HeadlessImageContextSizes() count] > 0 ? (CGContextRef)&HeadlessContext : NULL;
+}
+
+UIImage *UIGraphicsGetImageFromCurrentImageContext(void)
+{
+    NSValue *size = [HeadlessImageContextSizes() lastObject];
+
+    return size != nil ? [[UIImage alloc] initWithSize:[size CGSizeValue]] : nil;
+}
+
+void UIGraphicsEndImageContext(void)
+{
+    [HeadlessImageContextSizes() removeLastObject];
+}
+
+@implementation UIBezierPath
+
++ (UIBezierPath *)bezierPathWithRect:(__unused CGRect)rect
+{
+    return [[self alloc] init];
+}
+
++ (UIBezierPath *)bezierPathWithRoundedRect:(__unused CGRect)rect
+                          byRoundingCorners:(__unused UIRectCorner)corners
+                                cornerRadii:(__unused CGSize)cornerRadii
+{
+    return [[self alloc] init];
+}
+
+- (void)addClip
+{
+}
+
+- (CGPathRef)CGPath
+{
+    return NULL;
+}
+
+@end
+
+#pragma mark - UIKit views
+
+@implementation UIEvent
+
+@end
+
+@implementation UIResponder
+
+@end
+
+@interface UIView ()
+
+/* the view controller whose view this is, gets viewWillLayoutSubviews & viewDidLayoutSubviews */
+@property (nonatomic, weak) UIViewController *headlessViewController;
+
+@end
+
+@interface UIGestureRecognizer ()
+
+- (void)headlessAttachToView:(UIView *)view;
+
+@end
+
+static void HeadlessAutoresize(CGFloat delta,
+                               CGFloat *origin,
+                               CGFloat *size,
+                               BOOL flexStart,
+                               BOOL flexSize,
+                               BOOL flexEnd)
+{
+    /* the flexible parts (e.g. left margin, width, right margin) share the change evenly */
+    const CGFloat parts = (flexStart ? 1 : 0) + (flexSize ? 1 : 0) + (flexEnd ? 1 : 0);
+
+    if (parts > 0) {
+        if (flexStart) {
+            *origin += delta / parts;
+        }
+        if (flexSize) {
+            *size += delta / parts;
+        }
+    }
+}
+
+@implementation UIView {
+    CGRect _frame;
+    UIView __weak *_superview;
+    NSMutableArray *_subviews;
+    CALayer *_layer;
+    NSMutableArray *_gestureRecognizers;
+    BOOL _needsLayout;
+}
+
++ (void)animateWithDuration:(__unused NSTimeInterval)duration
+                      delay:(__unused NSTimeInterval)delay
+                    options:(__unused UIViewAnimationOptions)options
+                 animations:(void (^)(void))animations
+                 completion:(void (^)(BOOL finished))completion
+{
+    /* nothing is rendered, so every animation finishes right away */
+    if (animations != nil) {
+        animations();
+    }
+    if (completion != nil) {
+        completion(YES);
+    }
+}
+
++ (void)transitionWithView:(__unused UIView *)view
+                  duration:(NSTimeInterval)duration
+                   options:(UIViewAnimationOptions)options
+                animations:(void (^)(void))animations
+                completion:(void (^)(BOOL finished))completion
+{
+    [self animateWithDuration:duration delay:0 options:options animations:animations completion:completion];
+}
+
+- (id)init
+{
+    return [self initWithFrame:CGRectZero];
+}
+
+- (id)initWithFrame:(CGRect)frame
+{
+    if ((self = [super init])) {
+        _frame = frame;
+        _subviews = [[NSMutableArray alloc] init];
+        _layer = [[CALayer alloc] init];
+        _layer.frame = frame;
+        _gestureRecognizers = [[NSMutableArray alloc] init];
+        _alpha = 1;
+        _userInteractionEnabled = YES;
+        _needsLayout = YES;
+    }
+    return self;
+}
+
+- (CGRect)frame
+{
+    return _frame;
+}
+
+- (void)setFrame:(CGRect)frame
+{
+    const CGSize oldSize = _frame.size;
+
+    _frame = frame;
+    _layer.frame = frame;
+
+    if (!CGSizeEqualToSize(oldSize, frame.size)) {
+        for (UIView *view in [_subviews copy]) {
+            [view resizeWithOldSuperviewSize:oldSize newSuperviewSize:frame.size];
+        }
+        [self setNeedsLayout];
+    }
+}
+
+- (void)resizeWithOldSuperviewSize:(CGSize)oldSize newSuperviewSize:(CGSize)newSize
+{
+    const UIViewAutoresizing mask = self.autoresizingMask;
+    CGRect f = _frame;
+
+    HeadlessAutoresize(newSize.width - oldSize.width,
+                       &f.origin.x,
+                       &f.size.width,
+                       (mask & UIViewAutoresizingFlexibleLeftMargin) != 0,
+                       (mask & UIViewAutoresizingFlexibleWidth) != 0,
+                       (mask & UIViewAutoresizingFlexibleRightMargin) != 0);
+    HeadlessAutoresize(newSize.height - oldSize.height,
+                       &f.origin.y,
+                       &f.size.height,
+                       (mask & UIViewAutoresizingFlexibleTopMargin) != 0,
+                       (mask & UIViewAutoresizingFlexibleHeight) != 0,
+                       (mask & UIViewAutoresizingFlexibleBottomMargin) != 0);
+
+    if (!CGRectEqualToRect(f, _frame)) {
+        self.frame = f;
+    }
+}
+
+- (CGRect)bounds
+{
+    return CGRectMake(0, 0, CGRectGetWidth(_frame), CGRectGetHeight(_frame));
+}
+
+- (CGPoint)center
+{
+    return CGPointMake(CGRectGetMidX(_frame), CGRectGetMidY(_frame));
+}
+
+- (void)setCenter:(CGPoint)center
+{
+    self.frame = CGRectMake(center.x - CGRectGetWidth(_frame) / 2,
+                            center.y - CGRectGetHeight(_frame) / 2,
+                            CGRectGetWidth(_frame),
+                            CGRectGetHeight(_frame));
+}
+
+- (UIView *)superview
+{
+    return _superview;
+}
+
+- (NSArray *)subviews
+{
+    return [_subviews copy];
+}
+
+- (UIWindow *)window
+{
+    for (UIView *here = self; here != nil; here = here->_superview) {
+        if ([here isKindOfClass:[UIWindow class]]) {
+            return (UIWindow *)here;
+        }
+    }
+    return nil;
+}
+
+- (CALayer *)layer
+{
+    return _layer;
+}
+
+- (NSArray *)gestureRecognizers
+{
+    return [_gestureRecognizers copy];
+}
+
+- (void)addSubview:(UIView *)view
+{
+    [self insertSubview:view atIndex:(NSInteger)[_subviews count]];
+}
+
+- (void)insertSubview:(UIView *)view atIndex:(NSInteger)index
+{
+    if (view == nil || view == self) {
+        return;
+    }
+
+    if (view->_superview == self) {
+        [_subviews removeObjectIdenticalTo:view];
+    } else {
+        [view removeFromSuperview];
+        view->_superview = self;
+    }
+
+    [_subviews insertObject:view atIndex:MIN((NSUInteger)MAX(index, 0), [_subviews count])];
+    [self setNeedsLayout];
+}
+
+- (void)removeFromSuperview
+{
+    UIView *superview = _superview;
+
+    if (superview != nil) {
+        [superview->_subviews removeObjectIdenticalTo:self];
+        _superview = nil;
+        [superview setNeedsLayout];
+    }
+}
+
+- (BOOL)isDescendantOfView:(UIView *)view
+{
+    for (UIView *here = self; here != nil; here = here->_superview) {
+        if (here == view) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event
+{
+    if (_hidden || _alpha < 0.01 || !_userInteractionEnabled || !CGRectContainsPoint(self.bounds, point)) {
+        return nil;
+    }
+
+    for (UIView *view in [_subviews reverseObjectEnumerator]) {
+        UIView *hit = [view hitTest:CGPointMake(point.x - CGRectGetMinX(view->_frame),
+                                                point.y - CGRectGetMinY(view->_frame))
+                          withEvent:event];
+        if (hit != nil) {
+            return hit;
+        }
+    }
+    return self;
+}
+
+- (CGPoint)originInRootView
+{
+    CGPoint origin = CGPointZero;
+
+    for (UIView *here = self; here != nil; here = here->_superview) {
+        origin.x += CGRectGetMinX(here->_frame);
+        origin.y += CGRectGetMinY(here->_frame);
+    }
+    return origin;
+}
+
+- (CGPoint)convertPoint:(CGPoint)point toView:(UIView *)view
+{
+    const CGPoint from = [self originInRootView];
+    const CGPoint to = view != nil ? [view originInRootView] : CGPointZero;
+
+    return CGPointMake(point.x + from.x - to.x, point.y + from.y - to.y);
+}
+
+- (void)setNeedsLayout
+{
+    _needsLayout = YES;
+}
+
+- (void)layoutIfNeeded
+{
+    if (_needsLayout) {
+        UIViewController *viewController = self.headlessViewController;
+
+        _needsLayout = NO;
+        [viewController viewWillLayoutSubviews];
+        [self layoutSubviews];
+        [viewController viewDidLayoutSubviews];
+    }
+
+    for (UIView *view in [_subviews copy]) {
+        [view layoutIfNeeded];
+    }
+}
+
+- (void)layoutSubviews
+{
+}
+
+- (CGSize)sizeThatFits:(__unused CGSize)size
+{
+    return self.bounds.size;
+}
+
+- (void)drawRect:(__unused CGRect)rect
+{
+}
+
+- (void)addGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer
+{
+    if (gestureRecognizer != nil && ![_gestureRecognizers containsObject:gestureRecognizer]) {
+        [gestureRecognizer.view removeGestureRecognizer:gestureRecognizer];
+        [_gestureRecognizers addObject:gestureRecognizer];
+        [gestureRecognizer headlessAttachToView:self];
+    }
+}
+
+- (void)removeGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer
+{
+    if (gestureRecognizer != nil && [_gestureRecognizers containsObject:gestureRecognizer]) {
+        [_gestureRecognizers removeObjectIdenticalTo:gestureRecognizer];
+        [gestureRecognizer headlessAttachToView:nil];
+    }
+}
+
+@end
+
+static NSMutableArray *HeadlessWindows(void)
+{
+    static NSMutableArray *windows = nil;
+
+    if (windows == nil) {
+        windows = [[NSMutableArray alloc] init];
+    }
+    return windows;
+}
+
+@implementation UIWindow
+
+- (id)initWithFrame:(CGRect)frame
+{
+    if ((self = [super initWithFrame:frame])) {
+        /* like the key window, laid out on every run loop turn (and never released) */
+        [HeadlessWindows() addObject:self];
+    }
+    return self;
+}
+
+@end
+
+@implementation UIImageView
+
+- (id)initWithImage:(UIImage *)image
+{
+    if ((self = [super initWithFrame:CGRectMake(0, 0, image.size.width, image.size.height)])) {
+        _image = image;
+    }
+    return self;
+}
+
+@end
+
+@implementation UILabel
+
+- (CGSize)sizeThatFits:(__unused CGSize)size
+{
+    /* roughly what a 20pt bold font needs */
+    return CGSizeMake(10 * [self.text length], 20);
+}
+
+@end
+
+@implementation UIControl {
+    NSMutableArray *_targetActions;
+}
+
+- (void)addTarget:(id)target action:(SEL)action forControlEvents:(UIControlEvents)events
+{
+    if (_targetActions == nil) {
+        _targetActions = [[NSMutableArray alloc] init];
+    }
+
+    /* controls don't retain their targets */
+    [_targetActions addObject:@[[NSValue valueWithNonretainedObject:target],
+                                NSStringFromSelector(action),
+                                @(events)]];
+}
+
+- (void)sendActionsForControlEvents:(UIControlEvents)events
+{
+    for (NSArray *targetAction in [_targetActions copy]) {
+        if (([[targetAction objectAtIndex:2] unsignedIntegerValue] & events) != 0) {
+            id target = [[targetAction objectAtIndex:0] nonretainedObjectValue];
+            SEL action = NSSelectorFromString([targetAction objectAtIndex:1]);
+            void (*send)(id, SEL, id) = (void (*)(id, SEL, id))[target methodForSelector:action];
+
+            send(target, action, self);
+        }
+    }
+}
+
+@end
+
+@implementation UIButton {
+    NSMutableDictionary *_images;
+    UIImageView *_imageView;
+}
+
++ (id)buttonWithType:(__unused UIButtonType)buttonType
+{
+    return [[self alloc] initWithFrame:CGRectZero];
+}
+
+- (void)setImage:(UIImage *)image forState:(UIControlState)state
+{
+    if (_images == nil) {
+        _images = [[NSMutableDictionary alloc] init];
+    }
+
+    if (image != nil) {
+        [_images setObject:image forKey:@(state)];
+    } else {
+        [_images removeObjectForKey:@(state)];
+    }
+    [self setNeedsLayout];
+}
+
+- (UIImage *)imageForState:(UIControlState)state
+{
+    return [_images objectForKey:@(state)];
+}
+
+- (UIImageView *)imageView
+{
+    if (_imageView == nil) {
+        _imageView = [[UIImageView alloc] init];
+        [self addSubview:_imageView];
+    }
+    return _imageView;
+}
+
+@end
+
+@implementation UISlider
+
+@end
+
+@implementation UIScrollView
+
+@end
+
+@implementation UIBarButtonItem
+
+- (id)initWithBarButtonSystemItem:(__unused UIBarButtonSystemItem)systemItem
+                           target:(__unused id)target
+                           action:(__unused SEL)action
+{
+    return [super init];
+}
+
+@end
+
+@implementation UIToolbar
+
+- (void)setBackgroundImage:(__unused UIImage *)backgroundImage
+        forToolbarPosition:(__unused UIToolbarPosition)topOrBottom
+                barMetrics:(__unused UIBarMetrics)barMetrics
+{
+}
+
+@end
+
+#pragma mark - UIKit events
+
+@implementation UITouch {
+    UIView *_view;
+}
+
+- (id)initWithView:(UIView *)view
+{
+    if ((self = [super init])) {
+        _view = view;
+    }
+    return self;
+}
+
+- (UIView *)view
+{
+    return _view;
+}
+
+@end
+
+@implementation UIGestureRecognizer {
+    id __weak _target;
+    SEL _action;
+    UIView __weak *_view;
+    UIGestureRecognizerState _state;
+}
+
+- (id)initWithTarget:(id)target action:(SEL)action
+{
+    if ((self = [super init])) {
+        _target = target;
+        _action = action;
+        _enabled = YES;
+    }
+    return self;
+}
+
+- (void)removeTarget:(id)target action:(__unused SEL)action
+{
+    if (target == nil || target == _target) {
+        _target = nil;
+    }
+}
+
+- (void)headlessAttachToView:(UIView *)view
+{
+    _view = view;
+}
+
+- (UIView *)view
+{
+    return _view;
+}
+
+- (CGPoint)locationInView:(__unused UIView *)view
+{
+    return CGPointZero;
+}
+
+- (UIGestureRecognizerState)state
+{
+    return _state;
+}
+
+- (void)setState:(UIGestureRecognizerState)state
+{
+    id target = _target;
+
+    _state = state;
+
+    /* like UIKit, a failed recognizer doesn't send its action */
+    if (self.enabled && target != nil && state != UIGestureRecognizerStatePossible &&
+        state != UIGestureRecognizerStateFailed) {
+        void (*action)(id, SEL, id) = (void (*)(id, SEL, id))[target methodForSelector:_action];
+        action(target, _action, self);
+    }
+}
+
+@end
+
+@implementation UIPanGestureRecognizer {
+    CGPoint _translation;
+}
+
+- (CGPoint)translationInView:(__unused UIView *)view
+{
+    return _translation;
+}
+
+- (void)setTranslation:(CGPoint)translation inView:(__unused UIView *)view
+{
+    _translation = translation;
+}
+
+- (CGPoint)velocityInView:(__unused UIView *)view
+{
+    return CGPointZero;
+}
+
+@end
+
+#pragma mark - UIKit environment
+
+@implementation UIScreen
+
++ (UIScreen *)mainScreen
+{
+    static UIScreen *screen = nil;
+
+    if (screen == nil) {
+        screen = [[UIScreen alloc] init];
+    }
+    return screen;
+}
+
+- (CGRect)bounds
+{
+    /* a retina iPad, in portrait like UIKit reports it */
+    return CGRectMake(0, 0, 768, 1024);
+}
+
+- (CGFloat)scale
+{
+    return 2;
+}
+
+@end
+
+@implementation UIApplication
+
++ (UIApplication *)sharedApplication
+{
+    static UIApplication *application = nil;
+
+    if (application == nil) {
+        application = [[UIApplication alloc] init];
+    }
+    return application;
+}
+
+- (UIInterfaceOrientation)statusBarOrientation
+{
+    return UIInterfaceOrientationLandscapeLeft;
+}
+
+@end
+
+@implementation UIDevice
+
++ (UIDevice *)currentDevice
+{
+    static UIDevice *device = nil;
+
+    if (device == nil) {
+        device = [[UIDevice alloc] init];
+    }
+    return device;
+}
+
+- (NSString *)systemVersion
+{
+    return @"7.0";
+}
+
+@end
+
+#pragma mark - UIKit view controllers
+
+@implementation UIViewController {
+    UIView *_view;
+    UIViewController __weak *_parentViewController;
+    NSMutableArray *_childViewControllers;
+}
+
+- (id)init
+{
+    return [self initWithNibName:nil bundle:nil];
+}
+
+- (id)initWithNibName:(__unused NSString *)nibNameOrNil bundle:(__unused NSBundle *)nibBundleOrNil
+{
+    if ((self = [super init])) {
+        _childViewControllers = [[NSMutableArray alloc] init];
+    }
+    return self;
+}
+
+- (UIView *)view
+{
+    if (_view == nil) {
+        [self loadView];
+        [self viewDidLoad];
+    }
+    return _view;
+}
+
+- (void)setView:(UIView *)view
+{
+    _view.headlessViewController = nil;
+    _view = view;
+    view.headlessViewController = self;
+}
+
+- (UIViewController *)parentViewController
+{
+    return _parentViewController;
+}
+
+- (NSArray *)childViewControllers
+{
+    return [_childViewControllers copy];
+}
+
+- (BOOL)isViewLoaded
+{
+    return _view != nil;
+}
+
+- (void)loadView
+{
+    self.view = [[UIView alloc] initWithFrame:CGRectZero];
+}
+
+- (void)viewDidLoad
+{
+}
+
+- (void)viewWillUnload
+{
+}
+
+- (void)viewDidUnload
+{
+}
+
+- (void)viewDidAppear:(__unused BOOL)animated
+{
+}
+
+- (void)viewWillLayoutSubviews
+{
+}
+
+- (void)viewDidLayoutSubviews
+{
+}
+
+- (BOOL)shouldAutorotateToInterfaceOrientation:(UIInterfaceOrientation)toInterfaceOrientation
+{
+    return toInterfaceOrientation == UIInterfaceOrientationPortrait;
+}
+
+- (void)didRotateFromInterfaceOrientation:(__unused UIInterfaceOrientation)fromInterfaceOrientation
+{
+}
+
+- (void)viewWillTransitionToSize:(__unused CGSize)size
+       withTransitionCoordinator:(__unused id<UIViewControllerTransitionCoordinator>)coordinator
+{
+}
+
+- (void)addChildViewController:(UIViewController *)childController
+{
+    if (childController == nil || childController->_parentViewController == self) {
+        return;
+    }
+
+    /* like UIKit: sends willMoveToParentViewController: but leaves didMoveToParentViewController: to the caller */
+    [childController removeFromParentViewController];
+    [childController willMoveToParentViewController:self];
+    [_childViewControllers addObject:childController];
+    childController->_parentViewController = self;
+}
+
+- (void)removeFromParentViewController
+{
+    UIViewController *parent = _parentViewController;
+
+    if (parent != nil) {
+        /* like UIKit: sends didMoveToParentViewController:, the caller sent willMoveToParentViewController: */
+        [parent->_childViewControllers removeObjectIdenticalTo:self];
+        _parentViewController = nil;
+        [self didMoveToParentViewController:nil];
+    }
+}
+
+- (void)willMoveToParentViewController:(__unused UIViewController *)parent
+{
+}
+
+- (void)didMoveToParentViewController:(__unused UIViewController *)parent
+{
+}
+
+@end
+
+#pragma mark - HeadlessUIKit
+
+NSUInteger HeadlessUIKitLayerRenderCount(void)
+{
+    return HeadlessLayerRenderCount;
+}
+
+void HeadlessUIKitRunLoopTurn(void)
+{
+    /* the due timers and delayed performs */
+    [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate date]];
+
+    for (HeadlessRunLoopObserver *observer in [HeadlessRunLoopObservers() copy]) {
+        if ((observer.activities & kCFRunLoopBeforeWaiting) != 0) {
+            observer.block((__bridge CFRunLoopObserverRef)observer, kCFRunLoopBeforeWaiting);
+        }
+    }
+
+    /* what Core Animation does when it commits, after all the other observers */
+    for (UIWindow *window in HeadlessWindows()) {
+        [window layoutIfNeeded];
+    }
+}
@@ -0,0 +1,624 @@
+/*
+ * This file is part of FRLayeredNavigationController.
+ *
+ * Copyright (c) 2012-2015, Johannes Weiß <weiss@tux4u.de>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * The name of the author may not be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * HeadlessUIKit: just enough of UIKit, QuartzCore and CoreGraphics to build and run FRLayeredNavigationController
+ * without a screen (on Linux with GNUstep). Views and view controllers keep their geometry, hierarchy and
+ * containment state like UIKit does, nothing is ever rendered and animations don't exist (see
+ * FRRecordingViewBackend). Only meant for the tests in this directory.
+ */
+
+#ifndef HEADLESS_UIKIT_H
+#define HEADLESS_UIKIT_H
+
+/* Standard Library */
+#import <Foundation/Foundation.h>
+#include <float.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if __has_include(<dispatch/dispatch.h>)
+#include <dispatch/dispatch.h>
+#else
+typedef long dispatch_once_t;
+static inline void dispatch_once(dispatch_once_t *predicate, void (^block)(void))
+{
+    if (*predicate == 0) {
+        *predicate = 1;
+        block();
+    }
+}
+#endif
+
+#ifndef __unused
+#define __unused __attribute__((__unused__))
+#endif
+
+#pragma mark - CoreGraphics
+
+#ifndef CGFLOAT_DEFINED
+typedef double CGFloat;
+#define CGFLOAT_DEFINED 1
+#endif
+#ifndef CGFLOAT_MAX
+#define CGFLOAT_MAX DBL_MAX
+#endif
+
+struct CGPoint {
+    CGFloat x;
+    CGFloat y;
+};
+typedef struct CGPoint CGPoint;
+
+struct CGSize {
+    CGFloat width;
+    CGFloat height;
+};
+typedef struct CGSize CGSize;
+
+struct CGRect {
+    CGPoint origin;
+    CGSize size;
+};
+typedef struct CGRect CGRect;
+
+extern const CGPoint CGPointZero;
+extern const CGRect CGRectZero;
+extern const CGRect CGRectNull;
+
+CGPoint CGPointMake(CGFloat x, CGFloat y);
+CGSize CGSizeMake(CGFloat width, CGFloat height);
+CGRect CGRectMake(CGFloat x, CGFloat y, CGFloat width, CGFloat height);
+CGFloat CGRectGetMinX(CGRect rect);
+CGFloat CGRectGetMidX(CGRect rect);
+CGFloat CGRectGetMaxX(CGRect rect);
+CGFloat CGRectGetMinY(CGRect rect);
+CGFloat CGRectGetMidY(CGRect rect);
+CGFloat CGRectGetMaxY(CGRect rect);
+CGFloat CGRectGetWidth(CGRect rect);
+CGFloat CGRectGetHeight(CGRect rect);
+bool CGPointEqualToPoint(CGPoint point1, CGPoint point2);
+bool CGSizeEqualToSize(CGSize size1, CGSize size2);
+bool CGRectEqualToRect(CGRect rect1, CGRect rect2);
+bool CGRectIsNull(CGRect rect);
+bool CGRectIsEmpty(CGRect rect);
+bool CGRectIntersectsRect(CGRect rect1, CGRect rect2);
+bool CGRectContainsPoint(CGRect rect, CGPoint point);
+
+typedef struct HeadlessCGColor *CGColorRef;
+typedef struct HeadlessCGPath *CGPathRef;
+typedef struct HeadlessCGContext *CGContextRef;
+typedef struct HeadlessCGColorSpace *CGColorSpaceRef;
+typedef struct HeadlessCGGradient *CGGradientRef;
+typedef uint32_t CGGradientDrawingOptions;
+
+CGColorSpaceRef CGColorSpaceCreateDeviceRGB(void);
+void CGColorSpaceRelease(CGColorSpaceRef space);
+CGGradientRef CGGradientCreateWithColorComponents(CGColorSpaceRef space,
+                                                  const CGFloat components[],
+                                                  const CGFloat locations[],
+                                                  size_t count);
+void CGGradientRelease(CGGradientRef gradient);
+void CGContextDrawLinearGradient(CGContextRef context,
+                                 CGGradientRef gradient,
+                                 CGPoint startPoint,
+                                 CGPoint endPoint,
+                                 CGGradientDrawingOptions options);
+void CGContextSetFillColorWithColor(CGContextRef context, CGColorRef color);
+void CGContextFillRect(CGContextRef context, CGRect rect);
+
+NSString *NSStringFromCGPoint(CGPoint point);
+NSString *NSStringFromCGSize(CGSize size);
+NSString *NSStringFromCGRect(CGRect rect);
+
+@interface NSValue (HeadlessUIKitGeometry)
+
++ (NSValue *)valueWithCGPoint:(CGPoint)point;
++ (NSValue *)valueWithCGSize:(CGSize)size;
++ (NSValue *)valueWithCGRect:(CGRect)rect;
+
+@property (nonatomic, readonly) CGPoint CGPointValue;
+@property (nonatomic, readonly) CGSize CGSizeValue;
+@property (nonatomic, readonly) CGRect CGRectValue;
+
+@end
+
+#pragma mark - CoreFoundation run loop observers
+
+typedef const void *CFTypeRef;
+typedef const struct HeadlessCFAllocator *CFAllocatorRef;
+typedef const struct HeadlessCFString *CFStringRef;
+typedef struct HeadlessCFRunLoop *CFRunLoopRef;
+typedef struct HeadlessCFRunLoopObserver *CFRunLoopObserverRef;
+typedef unsigned char Boolean;
+typedef long CFIndex;
+typedef unsigned long CFOptionFlags;
+
+typedef enum {
+    kCFRunLoopEntry = (1UL << 0),
+    kCFRunLoopBeforeTimers = (1UL << 1),
+    kCFRunLoopBeforeSources = (1UL << 2),
+    kCFRunLoopBeforeWaiting = (1UL << 5),
+    kCFRunLoopAfterWaiting = (1UL << 6),
+    kCFRunLoopExit = (1UL << 7)
+} CFRunLoopActivity;
+
+extern const CFAllocatorRef kCFAllocatorDefault;
+extern const CFStringRef kCFRunLoopCommonModes;
+
+CFRunLoopRef CFRunLoopGetMain(void);
+CFRunLoopObserverRef CFRunLoopObserverCreateWithHandler(CFAllocatorRef allocator,
+                                                        CFOptionFlags activities,
+                                                        Boolean repeats,
+                                                        CFIndex order,
+                                                        void (^block)(CFRunLoopObserverRef observer,
+                                                                      CFRunLoopActivity activity));
+void CFRunLoopAddObserver(CFRunLoopRef runLoop, CFRunLoopObserverRef observer, CFStringRef mode);
+void CFRunLoopObserverInvalidate(CFRunLoopObserverRef observer);
+void CFRelease(CFTypeRef object);
+
+#pragma mark - QuartzCore
+
+@interface CALayer : NSObject
+
+@property (nonatomic) CGRect frame;
+@property (nonatomic) CGFloat shadowRadius;
+@property (nonatomic) CGSize shadowOffset;
+@property (nonatomic) float shadowOpacity;
+@property (nonatomic, assign) CGColorRef shadowColor;
+@property (nonatomic, assign) CGPathRef shadowPath;
+@property (nonatomic) CGFloat borderWidth;
+@property (nonatomic, assign) CGColorRef borderColor;
+
+/* always nil: nothing is ever rendered or animated */
+- (id)presentationLayer;
+- (void)removeAllAnimations;
+- (void)renderInContext:(CGContextRef)context;
+
+@end
+
+#pragma mark - UIKit constants
+
+typedef enum {
+    UIInterfaceOrientationPortrait = 1,
+    UIInterfaceOrientationPortraitUpsideDown = 2,
+    UIInterfaceOrientationLandscapeLeft = 4,
+    UIInterfaceOrientationLandscapeRight = 3
+} UIInterfaceOrientation;
+
+#define UIInterfaceOrientationIsLandscape(orientation) \
+    ((orientation) == UIInterfaceOrientationLandscapeLeft || (orientation) == UIInterfaceOrientationLandscapeRight)
+
+typedef NSUInteger UIViewAutoresizing;
+enum {
+    UIViewAutoresizingNone = 0,
+    UIViewAutoresizingFlexibleLeftMargin = 1 << 0,
+    UIViewAutoresizingFlexibleWidth = 1 << 1,
+    UIViewAutoresizingFlexibleRightMargin = 1 << 2,
+    UIViewAutoresizingFlexibleTopMargin = 1 << 3,
+    UIViewAutoresizingFlexibleHeight = 1 << 4,
+    UIViewAutoresizingFlexibleBottomMargin = 1 << 5
+};
+
+typedef NSUInteger UIViewAnimationOptions;
+enum {
+    UIViewAnimationOptionBeginFromCurrentState = 1 << 2,
+    UIViewAnimationOptionAllowUserInteraction = 1 << 1,
+    UIViewAnimationOptionCurveEaseInOut = 0 << 16,
+    UIViewAnimationOptionCurveEaseIn = 1 << 16,
+    UIViewAnimationOptionCurveEaseOut = 2 << 16,
+    UIViewAnimationOptionCurveLinear = 3 << 16,
+    UIViewAnimationOptionTransitionCrossDissolve = 5 << 20
+};
+
+typedef enum {
+    UIViewContentModeScaleToFill,
+    UIViewContentModeScaleAspectFit,
+    UIViewContentModeScaleAspectFill
+} UIViewContentMode;
+
+typedef NSUInteger UIRectCorner;
+enum {
+    UIRectCornerTopLeft = 1 << 0,
+    UIRectCornerTopRight = 1 << 1,
+    UIRectCornerBottomLeft = 1 << 2,
+    UIRectCornerBottomRight = 1 << 3
+};
+
+typedef enum {
+    UITextAlignmentLeft,
+    UITextAlignmentCenter,
+    UITextAlignmentRight
+} UITextAlignment;
+
+extern NSString *const UITextAttributeFont;
+extern NSString *const UITextAttributeTextColor;
+extern NSString *const UITextAttributeTextShadowColor;
+extern NSString *const UITextAttributeTextShadowOffset;
+
+typedef enum {
+    UIButtonTypeCustom
+} UIButtonType;
+
+typedef NSUInteger UIControlState;
+enum {
+    UIControlStateNormal = 0
+};
+
+typedef NSUInteger UIControlEvents;
+enum {
+    UIControlEventTouchUpInside = 1 << 6
+};
+
+typedef enum {
+    UIControlContentHorizontalAlignmentCenter,
+    UIControlContentHorizontalAlignmentFill = 3
+} UIControlContentHorizontalAlignment;
+
+typedef enum {
+    UIControlContentVerticalAlignmentCenter,
+    UIControlContentVerticalAlignmentFill = 3
+} UIControlContentVerticalAlignment;
+
+typedef enum {
+    UIToolbarPositionAny
+} UIToolbarPosition;
+
+typedef enum {
+    UIBarMetricsDefault
+} UIBarMetrics;
+
+typedef enum {
+    UIBarButtonSystemItemFlexibleSpace = 5
+} UIBarButtonSystemItem;
+
+typedef enum {
+    UIGestureRecognizerStatePossible,
+    UIGestureRecognizerStateBegan,
+    UIGestureRecognizerStateChanged,
+    UIGestureRecognizerStateEnded,
+    UIGestureRecognizerStateCancelled,
+    UIGestureRecognizerStateFailed
+} UIGestureRecognizerState;
+
+#pragma mark - UIKit classes
+
+@class UIView;
+@class UIWindow;
+@class UIViewController;
+@class UIGestureRecognizer;
+@class UITouch;
+
+@interface UIColor : NSObject
+
++ (UIColor *)colorWithWhite:(CGFloat)white alpha:(CGFloat)alpha;
++ (UIColor *)colorWithRed:(CGFloat)red green:(CGFloat)green blue:(CGFloat)blue alpha:(CGFloat)alpha;
++ (UIColor *)clearColor;
++ (UIColor *)blackColor;
++ (UIColor *)whiteColor;
++ (UIColor *)redColor;
+
+@property (nonatomic, readonly) CGColorRef CGColor;
+
+@end
+
+@interface UIFont : NSObject
+
++ (UIFont *)boldSystemFontOfSize:(CGFloat)fontSize;
+
+@end
+
+@interface UIImage : NSObject
+
+@property (nonatomic, readonly) CGSize size;
+
+@end
+
+@interface UIImage (HeadlessUIKit)
+
+/* an image without any pixels, only its size is known */
+- (id)initWithSize:(CGSize)size;
+
+@end
+
+void UIGraphicsBeginImageContext(CGSize size);
+void UIGraphicsBeginImageContextWithOptions(CGSize size, BOOL opaque, CGFloat scale);
+CGContextRef UIGraphicsGetCurrentContext(void);
+UIImage *UIGraphicsGetImageFromCurrentImageContext(void);
+void UIGraphicsEndImageContext(void);
+
+@interface UIBezierPath : NSObject
+
++ (UIBezierPath *)bezierPathWithRect:(CGRect)rect;
++ (UIBezierPath *)bezierPathWithRoundedRect:(CGRect)rect
+                          byRoundingCorners:(UIRectCorner)corners
+                                cornerRadii:(CGSize)cornerRadii;
+- (void)addClip;
+
+@property (nonatomic, readonly) CGPathRef CGPath;
+
+@end
+
+@interface UIEvent : NSObject
+
+@end
+
+@interface UIResponder : NSObject
+
+@end
+
+@protocol UIAppearanceContainer <NSObject>
+@end
+
+@protocol UIAppearance <NSObject>
+
++ (id)appearance;
++ (id)appearanceWhenContainedIn:(Class <UIAppearanceContainer>)ContainerClass, ...;
+
+@end
+
+@interface UIView : UIResponder<UIAppearanceContainer>
+
++ (void)animateWithDuration:(NSTimeInterval)duration
+                      delay:(NSTimeInterval)delay
+                    options:(UIViewAnimationOptions)options
+                 animations:(void (^)(void))animations
+                 completion:(void (^)(BOOL finished))completion;
++ (void)transitionWithView:(UIView *)view
+                  duration:(NSTimeInterval)duration
+                   options:(UIViewAnimationOptions)options
+                animations:(void (^)(void))animations
+                completion:(void (^)(BOOL finished))completion;
+
+- (id)initWithFrame:(CGRect)frame;
+
+@property (nonatomic) CGRect frame;
+@property (nonatomic, readonly) CGRect bounds;
+@property (nonatomic) CGPoint center;
+@property (nonatomic, readonly) UIView *superview;
+@property (nonatomic, readonly, copy) NSArray *subviews;
+@property (nonatomic, readonly) UIWindow *window;
+@property (nonatomic, readonly, strong) CALayer *layer;
+@property (nonatomic, strong) UIColor *backgroundColor;
+@property (nonatomic, getter=isHidden) BOOL hidden;
+@property (nonatomic) CGFloat alpha;
+@property (nonatomic) UIViewAutoresizing autoresizingMask;
+@property (nonatomic) UIViewContentMode contentMode;
+@property (nonatomic) BOOL clipsToBounds;
+@property (nonatomic, getter=isUserInteractionEnabled) BOOL userInteractionEnabled;
+@property (nonatomic, readonly, copy) NSArray *gestureRecognizers;
+
+- (void)addSubview:(UIView *)view;
+- (void)insertSubview:(UIView *)view atIndex:(NSInteger)index;
+- (void)removeFromSuperview;
+- (BOOL)isDescendantOfView:(UIView *)view;
+- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event;
+- (CGPoint)convertPoint:(CGPoint)point toView:(UIView *)view;
+
+- (void)setNeedsLayout;
+- (void)layoutIfNeeded;
+- (void)layoutSubviews;
+- (CGSize)sizeThatFits:(CGSize)size;
+- (void)drawRect:(CGRect)rect;
+
+- (void)addGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer;
+- (void)removeGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer;
+
+@end
+
+@interface UIWindow : UIView
+
+@end
+
+@interface UIImageView : UIView
+
+- (id)initWithImage:(UIImage *)image;
+
+@property (nonatomic, strong) UIImage *image;
+
+@end
+
+@interface UILabel : UIView
+
+@property (nonatomic, copy) NSString *text;
+@property (nonatomic, strong) UIFont *font;
+@property (nonatomic, strong) UIColor *textColor;
+@property (nonatomic, strong) UIColor *shadowColor;
+@property (nonatomic) CGSize shadowOffset;
+@property (nonatomic) UITextAlignment textAlignment;
+
+@end
+
+@interface UIControl : UIView
+
+- (void)addTarget:(id)target action:(SEL)action forControlEvents:(UIControlEvents)controlEvents;
+- (void)sendActionsForControlEvents:(UIControlEvents)controlEvents;
+
+@property (nonatomic) UIControlContentHorizontalAlignment contentHorizontalAlignment;
+@property (nonatomic) UIControlContentVerticalAlignment contentVerticalAlignment;
+
+@end
+
+@interface UIButton : UIControl
+
++ (id)buttonWithType:(UIButtonType)buttonType;
+
+- (void)setImage:(UIImage *)image forState:(UIControlState)state;
+- (UIImage *)imageForState:(UIControlState)state;
+
+@property (nonatomic, readonly, strong) UIImageView *imageView;
+
+@end
+
+@interface UISlider : UIControl
+
+@end
+
+@interface UIScrollView : UIView
+
+@property (nonatomic) CGSize contentSize;
+
+@end
+
+@interface UIBarButtonItem : NSObject
+
+- (id)initWithBarButtonSystemItem:(UIBarButtonSystemItem)systemItem target:(id)target action:(SEL)action;
+
+@end
+
+@interface UIToolbar : UIView
+
+- (void)setBackgroundImage:(UIImage *)backgroundImage
+        forToolbarPosition:(UIToolbarPosition)topOrBottom
+                barMetrics:(UIBarMetrics)barMetrics;
+
+@property (nonatomic, copy) NSArray *items;
+
+@end
+
+@interface UITouch : NSObject
+
+@property (nonatomic, readonly) UIView *view;
+
+@end
+
+@protocol UIGestureRecognizerDelegate <NSObject>
+@optional
+
+- (BOOL)gestureRecognizerShouldBegin:(UIGestureRecognizer *)gestureRecognizer;
+- (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldReceiveTouch:(UITouch *)touch;
+
+@end
+
+@interface UIGestureRecognizer : NSObject
+
+- (id)initWithTarget:(id)target action:(SEL)action;
+- (void)removeTarget:(id)target action:(SEL)action;
+- (CGPoint)locationInView:(UIView *)view;
+
+@property (nonatomic, readonly) UIGestureRecognizerState state;
+@property (nonatomic, weak) id<UIGestureRecognizerDelegate> delegate;
+@property (nonatomic, readonly) UIView *view;
+@property (nonatomic, getter=isEnabled) BOOL enabled;
+
+@end
+
+@interface UIPanGestureRecognizer : UIGestureRecognizer
+
+- (CGPoint)translationInView:(UIView *)view;
+- (void)setTranslation:(CGPoint)translation inView:(UIView *)view;
+- (CGPoint)velocityInView:(UIView *)view;
+
+@property (nonatomic) NSUInteger maximumNumberOfTouches;
+
+@end
+
+@interface UIScreen : NSObject
+
++ (UIScreen *)mainScreen;
+
+@property (nonatomic, readonly) CGRect bounds;
+@property (nonatomic, readonly) CGFloat scale;
+
+@end
+
+@interface UIApplication : UIResponder
+
++ (UIApplication *)sharedApplication;
+
+@property (nonatomic, readonly) UIInterfaceOrientation statusBarOrientation;
+
+@end
+
+@interface UIDevice : NSObject
+
++ (UIDevice *)currentDevice;
+
+@property (nonatomic, readonly, copy) NSString *systemVersion;
+
+@end
+
+@protocol UIViewControllerTransitionCoordinatorContext <NSObject>
+@end
+
+@protocol UIViewControllerTransitionCoordinator <UIViewControllerTransitionCoordinatorContext>
+
+- (BOOL)animateAlongsideTransition:(void (^)(id<UIViewControllerTransitionCoordinatorContext> context))animation
+                        completion:(void (^)(id<UIViewControllerTransitionCoordinatorContext> context))completion;
+
+@end
+
+@interface UIViewController : UIResponder
+
+- (id)initWithNibName:(NSString *)nibNameOrNil bundle:(NSBundle *)nibBundleOrNil;
+
+@property (nonatomic, strong) UIView *view;
+@property (nonatomic, copy) NSString *title;
+@property (nonatomic, readonly) UIViewController *parentViewController;
+@property (nonatomic, readonly) NSArray *childViewControllers;
+
+- (BOOL)isViewLoaded;
+- (void)loadView;
+- (void)viewDidLoad;
+- (void)viewWillUnload;
+- (void)viewDidUnload;
+- (void)viewDidAppear:(BOOL)animated;
+- (void)viewWillLayoutSubviews;
+- (void)viewDidLayoutSubviews;
+- (BOOL)shouldAutorotateToInterfaceOrientation:(UIInterfaceOrientation)toInterfaceOrientation;
+- (void)didRotateFromInterfaceOrientation:(UIInterfaceOrientation)fromInterfaceOrientation;
+- (void)viewWillTransitionToSize:(CGSize)size
+       withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator;
+
+- (void)addChildViewController:(UIViewController *)childController;
+- (void)removeFromParentViewController;
+- (void)willMoveToParentViewController:(UIViewController *)parent;
+- (void)didMoveToParentViewController:(UIViewController *)parent;
+
+@end
+
+#pragma mark - HeadlessUIKit
+
+@interface UITouch (HeadlessUIKit)
+
+/* a touch which has begun in view */
+- (id)initWithView:(UIView *)view;
+
+@end
+
+/*
+ * What the run loop does between two events on a device: lays out the views of all the windows (which calls
+ * viewWillLayoutSubviews on the view controllers owning them), runs the due timers and delayed performs and fires
+ * the kCFRunLoopBeforeWaiting observers.
+ */
+void HeadlessUIKitRunLoopTurn(void);
+
+/* how many times a layer got rendered (renderInContext:) so far */
+NSUInteger HeadlessUIKitLayerRenderCount(void);
+
+#endif
@@ -41,7 +41,7 @@ while read file; do
     check "$file" '^[+-]\([a-z *]+\)' -EHn "method declaration/definition syntax"
     check "$file" '@synthesize' -Hn "@synthesize found"
     check "$file" '^[+-] \(.*\).*\{' -EHn "method definition: { not on next line"
-done < <(find FRLayeredNavigationController -name '*.h' \
+done < <(find FRLayeredNavigationController Tests -name '*.h' \
               -or -name '*.m' -type f)
 
 if [ $RET -eq 0 ]; then